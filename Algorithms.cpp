@@ -7,236 +7,3143 @@
 #include <queue>
 #include <vector>
 #include <string>
+#include <deque>
+#include <utility>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+#include <cmath>
+#include <map>
+#include <unordered_map>
+#include <random>
+#include <atomic>
 #include "Algorithms.hpp"
+#include "Parallel.hpp"
 #include <limits>
 
+namespace {
+
+    /**
+     * @brief Builds the out-neighbour lists of a graph from its adjacency matrix.
+     *
+     * @param g The adjacency matrix (a non-zero entry g[u][v] is an edge u->v).
+     * @return The list of (neighbour, weight) pairs of every vertex.
+     */
+    std::vector<std::vector<std::pair<int, int>>> adjacencyLists(const std::vector<std::vector<int>>& g) {
+        int n = g.size();
+        std::vector<std::vector<std::pair<int, int>>> adj(n);
+        for (int u = 0; u < n; ++u) {
+            for (int v = 0; v < n; ++v) {
+                if (g[u][v] != 0) adj[u].push_back({v, g[u][v]});
+            }
+        }
+        return adj;
+    }
+
+    /**
+     * @brief Moves every cycle of the predecessor graph into cycles and removes its vertices.
+     *
+     * Each vertex is walked at most once, so a check costs O(n).
+     *
+     * @param predecessor The predecessor of every vertex, -1 for roots.
+     * @param removed The vertices already taken by earlier cycles; updated in place.
+     * @param cycles The cycles found so far; new cycles are appended in edge order, closed
+     *        by repeating their first vertex.
+     * @return bool Returns true if at least one new cycle was found.
+     */
+    bool extractPredecessorCycles(const std::vector<int>& predecessor, std::vector<bool>& removed,
+                                  std::vector<std::vector<int>>& cycles) {
+        int n = predecessor.size();
+        std::vector<int> walk(n, -1);
+        bool found = false;
+        for (int start = 0; start < n; ++start) {
+            int v = start;
+            while (v != -1 && !removed[v] && walk[v] == -1) {
+                walk[v] = start;
+                v = predecessor[v];
+            }
+            if (v == -1 || removed[v] || walk[v] != start) continue;
+
+            // v is on a cycle of the walk that started at start
+            std::vector<int> cycle;
+            int u = v;
+            do {
+                cycle.push_back(u);
+                u = predecessor[u];
+            } while (u != v);
+            cycle.push_back(v);
+            // the walk followed predecessors, i.e. the edges backwards
+            std::reverse(cycle.begin(), cycle.end());
+            for (int w : cycle) removed[w] = true;
+            cycles.push_back(cycle);
+            found = true;
+        }
+        return found;
+    }
+
+    /**
+     * @brief Queue-based Bellman-Ford from a virtual super-source joined to every vertex by a 0 edge.
+     *
+     * Relaxation stops as soon as no distance changes. Every n relaxations the predecessor
+     * graph is checked for cycles; each one found is recorded and its vertices are removed.
+     *
+     * @param adj The out-neighbour lists of the graph.
+     * @param dist Receives the distance of every vertex from the super-source.
+     * @return The vertex-disjoint negative cycles found. If it is empty, dist is a feasible
+     *         potential: dist[u] + w(u, v) >= dist[v] for every edge.
+     */
+    std::vector<std::vector<int>> relaxFromSuperSource(const std::vector<std::vector<std::pair<int, int>>>& adj,
+                                                       std::vector<long long>& dist) {
+        int n = adj.size();
+        // virtual super-source: every vertex starts at distance 0 and in the queue
+        dist.assign(n, 0);
+        std::vector<int> predecessor(n, -1);
+        std::vector<bool> removed(n, false);
+        std::vector<bool> inQueue(n, true);
+        std::deque<int> queue;
+        for (int v = 0; v < n; ++v) queue.push_back(v);
+
+        std::vector<std::vector<int>> cycles;
+        long long relaxations = 0;
+        while (!queue.empty()) {
+            int u = queue.front();
+            queue.pop_front();
+            inQueue[u] = false;
+            if (removed[u]) continue;
+
+            for (const std::pair<int, int>& edge : adj[u]) {
+                int v = edge.first;
+                if (removed[v] || dist[u] + edge.second >= dist[v]) continue;
+                dist[v] = dist[u] + edge.second;
+                predecessor[v] = u;
+                if (!inQueue[v]) {
+                    inQueue[v] = true;
+                    queue.push_back(v);
+                }
+                // a cycle in the predecessor graph is always a negative cycle
+                if (++relaxations % n == 0 && extractPredecessorCycles(predecessor, removed, cycles) && removed[u]) {
+                    break;
+                }
+            }
+        }
+        return cycles;
+    }
+
+    const int FLOYD_BLOCK = 64; ///< Side of the square tiles used by blocked Floyd-Warshall.
+
+    /**
+     * @brief Relaxes tile (bi, bj) of the distance matrix through every k of tile bk.
+     *
+     * The inner loop runs over one contiguous row with no branches so the compiler can
+     * vectorise it.
+     */
+    void floydTile(long long* dist, int* next, int n, int bi, int bj, int bk) {
+        const long long unreachable = Algorithms::DistanceTable::INF / 2;
+        int iEnd = std::min(bi + FLOYD_BLOCK, n);
+        int jEnd = std::min(bj + FLOYD_BLOCK, n);
+        int kEnd = std::min(bk + FLOYD_BLOCK, n);
+        for (int k = bk; k < kEnd; ++k) {
+            const long long* rowK = dist + static_cast<size_t>(k) * n;
+            for (int i = bi; i < iEnd; ++i) {
+                long long* rowI = dist + static_cast<size_t>(i) * n;
+                int* nextI = next + static_cast<size_t>(i) * n;
+                long long dik = rowI[k];
+                if (dik > unreachable) continue;
+                int hop = nextI[k];
+                for (int j = bj; j < jEnd; ++j) {
+                    long long candidate = dik + rowK[j];
+                    bool better = candidate < rowI[j];
+                    rowI[j] = better ? candidate : rowI[j];
+                    nextI[j] = better ? hop : nextI[j];
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Three-phase blocked Floyd-Warshall over a row-major distance matrix.
+     *
+     * For each diagonal tile: the tile itself is closed first, then its tile row and tile
+     * column (in parallel), then every remaining tile (in parallel by tile row).
+     */
+    void blockedFloydWarshall(Algorithms::DistanceTable& table) {
+        int n = table.n;
+        int tiles = (n + FLOYD_BLOCK - 1) / FLOYD_BLOCK;
+        long long* dist = table.dist.data();
+        int* next = table.next.data();
+        for (int t = 0; t < tiles; ++t) {
+            int bk = t * FLOYD_BLOCK;
+            floydTile(dist, next, n, bk, bk, bk);
+            Parallel::forRange(0, tiles, 2, [&](int lo, int hi) {
+                for (int o = lo; o < hi; ++o) {
+                    if (o == t) continue;
+                    floydTile(dist, next, n, bk, o * FLOYD_BLOCK, bk);
+                    floydTile(dist, next, n, o * FLOYD_BLOCK, bk, bk);
+                }
+            });
+            Parallel::forRange(0, tiles, 1, [&](int lo, int hi) {
+                for (int r = lo; r < hi; ++r) {
+                    if (r == t) continue;
+                    for (int c = 0; c < tiles; ++c) {
+                        if (c != t) floydTile(dist, next, n, r * FLOYD_BLOCK, c * FLOYD_BLOCK, bk);
+                    }
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Johnson: reweights with super-source potentials, then runs a Dijkstra per source.
+     *
+     * Sources are split across threads; each thread reuses one set of work arrays.
+     */
+    void johnson(const std::vector<std::vector<int>>& g, Algorithms::DistanceTable& table) {
+        const long long INF = Algorithms::DistanceTable::INF;
+        int n = table.n;
+        std::vector<std::vector<std::pair<int, int>>> adj = adjacencyLists(g);
+        std::vector<long long> h;
+        if (!relaxFromSuperSource(adj, h).empty()) {
+            table.negativeCycle = true;
+            return;
+        }
+
+        Parallel::forRange(0, n, 4, [&](int lo, int hi) {
+            typedef std::pair<long long, int> Entry;
+            std::vector<long long> d(n);
+            std::vector<int> first(n);
+            std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+            for (int s = lo; s < hi; ++s) {
+                std::fill(d.begin(), d.end(), INF);
+                d[s] = 0;
+                first[s] = s;
+                heap.push({0, s});
+                while (!heap.empty()) {
+                    Entry top = heap.top();
+                    heap.pop();
+                    int u = top.second;
+                    if (top.first > d[u]) continue;
+                    for (const std::pair<int, int>& edge : adj[u]) {
+                        int v = edge.first;
+                        // reduced weight, never negative thanks to the potentials
+                        long long nd = top.first + edge.second + h[u] - h[v];
+                        if (nd < d[v]) {
+                            d[v] = nd;
+                            first[v] = u == s ? v : first[u];
+                            heap.push({nd, v});
+                        }
+                    }
+                }
+                long long* row = table.dist.data() + static_cast<size_t>(s) * n;
+                int* nextRow = table.next.data() + static_cast<size_t>(s) * n;
+                for (int v = 0; v < n; ++v) {
+                    row[v] = d[v] == INF ? INF : d[v] - h[s] + h[v];
+                    nextRow[v] = d[v] == INF ? -1 : first[v];
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief Union-find over vertex indices with path halving and union by size.
+     */
+    struct DisjointSets {
+        std::vector<int> parent;
+        std::vector<int> size;
+
+        explicit DisjointSets(int n) : parent(n), size(n, 1) {
+            std::iota(parent.begin(), parent.end(), 0);
+        }
+
+        int find(int v) {
+            while (parent[v] != v) {
+                parent[v] = parent[parent[v]];
+                v = parent[v];
+            }
+            return v;
+        }
+
+        /**
+         * @brief Merges the sets of a and b.
+         * @return bool Returns false if a and b were already in the same set.
+         */
+        bool unite(int a, int b) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return false;
+            if (size[a] < size[b]) std::swap(a, b);
+            parent[b] = a;
+            size[a] += size[b];
+            return true;
+        }
+    };
+
+    /**
+     * @brief Returns the undirected weight between u and v (0 if they are not adjacent).
+     *
+     * If both directions are present the smaller weight is used.
+     */
+    int undirectedWeight(const std::vector<std::vector<int>>& g, int u, int v) {
+        int a = g[u][v];
+        int b = g[v][u];
+        if (a == 0) return b;
+        if (b == 0) return a;
+        return std::min(a, b);
+    }
+
+    /**
+     * @brief Lists the undirected edges of the graph, each once with u < v.
+     */
+    std::vector<Algorithms::Edge> undirectedEdges(const std::vector<std::vector<int>>& g) {
+        int n = g.size();
+        std::vector<Algorithms::Edge> edges;
+        for (int u = 0; u < n; ++u) {
+            for (int v = u + 1; v < n; ++v) {
+                int w = undirectedWeight(g, u, v);
+                if (w != 0) edges.push_back({u, v, w});
+            }
+        }
+        return edges;
+    }
+
+    /**
+     * @brief Sorts edges by weight with a stable LSD radix sort (four 8-bit passes).
+     */
+    void radixSortByWeight(std::vector<Algorithms::Edge>& edges) {
+        std::vector<Algorithms::Edge> buffer(edges.size());
+        for (int shift = 0; shift < 32; shift += 8) {
+            std::vector<size_t> count(257, 0);
+            for (const Algorithms::Edge& e : edges) {
+                // flipping the sign bit orders negative weights before positive ones
+                unsigned int key = static_cast<unsigned int>(e.weight) ^ 0x80000000u;
+                ++count[((key >> shift) & 0xFF) + 1];
+            }
+            for (int b = 0; b < 256; ++b) count[b + 1] += count[b];
+            for (const Algorithms::Edge& e : edges) {
+                unsigned int key = static_cast<unsigned int>(e.weight) ^ 0x80000000u;
+                buffer[count[(key >> shift) & 0xFF]++] = e;
+            }
+            edges.swap(buffer);
+        }
+    }
+
+    /**
+     * @brief Dense Prim: one O(n) scan of a matrix row per added vertex.
+     */
+    Algorithms::SpanningForest primForest(const std::vector<std::vector<int>>& g) {
+        int n = g.size();
+        Algorithms::SpanningForest forest;
+        std::vector<int> key(n, 0);
+        std::vector<int> parent(n, -1);
+        std::vector<bool> inTree(n, false);
+
+        for (int root = 0; root < n; ++root) {
+            if (inTree[root]) continue;
+            int u = root;
+            while (u != -1) {
+                inTree[u] = true;
+                if (parent[u] != -1) {
+                    forest.edges.push_back({std::min(u, parent[u]), std::max(u, parent[u]), key[u]});
+                    forest.totalWeight += key[u];
+                }
+                // update the keys through u and pick the cheapest vertex on the frontier
+                int next = -1;
+                for (int v = 0; v < n; ++v) {
+                    if (inTree[v]) continue;
+                    int w = undirectedWeight(g, u, v);
+                    if (w != 0 && (parent[v] == -1 || w < key[v])) {
+                        key[v] = w;
+                        parent[v] = u;
+                    }
+                    if (parent[v] != -1 && (next == -1 || key[v] < key[next])) next = v;
+                }
+                u = next;
+            }
+        }
+        return forest;
+    }
+
+    /**
+     * @brief Kruskal over the radix-sorted edge list.
+     */
+    Algorithms::SpanningForest kruskalForest(const std::vector<std::vector<int>>& g) {
+        int n = g.size();
+        Algorithms::SpanningForest forest;
+        std::vector<Algorithms::Edge> edges = undirectedEdges(g);
+        radixSortByWeight(edges);
+        DisjointSets sets(n);
+        for (const Algorithms::Edge& e : edges) {
+            if (!sets.unite(e.u, e.v)) continue;
+            forest.edges.push_back(e);
+            forest.totalWeight += e.weight;
+            if (static_cast<int>(forest.edges.size()) == n - 1) break;
+        }
+        return forest;
+    }
+
+    /**
+     * @brief Boruvka: each round every component picks its cheapest outgoing edge.
+     *
+     * The cheapest-edge search is split across threads by vertex; ties are broken by edge
+     * index so that the chosen edges never close a cycle.
+     */
+    Algorithms::SpanningForest boruvkaForest(const std::vector<std::vector<int>>& g) {
+        int n = g.size();
+        Algorithms::SpanningForest forest;
+        std::vector<Algorithms::Edge> edges = undirectedEdges(g);
+        std::vector<std::vector<int>> incident(n);
+        for (int id = 0; id < static_cast<int>(edges.size()); ++id) {
+            incident[edges[id].u].push_back(id);
+            incident[edges[id].v].push_back(id);
+        }
+        auto lighter = [&edges](int a, int b) {
+            return edges[a].weight < edges[b].weight || (edges[a].weight == edges[b].weight && a < b);
+        };
+
+        DisjointSets sets(n);
+        std::vector<int> component(n);
+        std::iota(component.begin(), component.end(), 0);
+        std::vector<int> vertexBest(n);
+        std::vector<int> componentBest(n);
+        while (true) {
+            Parallel::forRange(0, n, 1024, [&](int lo, int hi) {
+                for (int u = lo; u < hi; ++u) {
+                    int best = -1;
+                    for (int id : incident[u]) {
+                        int other = edges[id].u == u ? edges[id].v : edges[id].u;
+                        if (component[other] == component[u]) continue;
+                        if (best == -1 || lighter(id, best)) best = id;
+                    }
+                    vertexBest[u] = best;
+                }
+            });
+
+            std::fill(componentBest.begin(), componentBest.end(), -1);
+            for (int u = 0; u < n; ++u) {
+                int id = vertexBest[u];
+                int c = component[u];
+                if (id != -1 && (componentBest[c] == -1 || lighter(id, componentBest[c]))) componentBest[c] = id;
+            }
+
+            bool merged = false;
+            for (int c = 0; c < n; ++c) {
+                int id = componentBest[c];
+                if (id == -1 || !sets.unite(edges[id].u, edges[id].v)) continue;
+                forest.edges.push_back(edges[id]);
+                forest.totalWeight += edges[id].weight;
+                merged = true;
+            }
+            if (!merged) break;
+            for (int v = 0; v < n; ++v) component[v] = sets.find(v);
+        }
+        return forest;
+    }
+
+    /**
+     * @brief Work arrays of one thread running Brandes' algorithm, reused for every source.
+     */
+    struct BrandesWorkspace {
+        std::vector<long long> dist; ///< Distance from the source, -1 if not reached.
+        std::vector<double> paths; ///< Number of shortest paths from the source.
+        std::vector<double> dependency; ///< Dependency of the source on each vertex.
+        std::vector<int> order; ///< Reached vertices in order of distance.
+
+        explicit BrandesWorkspace(int n) : dist(n, -1), paths(n, 0), dependency(n, 0) {
+            order.reserve(n);
+        }
+
+        /**
+         * @brief Adds the dependencies of source s into score.
+         *
+         * Vertices are settled in order of distance (BFS order, or Dijkstra order when
+         * weighted), counting shortest paths on the way. Dependencies are then accumulated
+         * in reverse order over out-edges: an edge v->w lies on a shortest path exactly when
+         * dist[w] = dist[v] + length, and w is finished before v because it settled later.
+         * Only the reached vertices are reset afterwards.
+         */
+        void accumulate(const std::vector<std::vector<std::pair<int, int>>>& adj, int s, bool weighted,
+                        std::vector<double>& score) {
+            order.clear();
+            dist[s] = 0;
+            paths[s] = 1;
+            if (!weighted) {
+                order.push_back(s);
+                for (size_t head = 0; head < order.size(); ++head) {
+                    int u = order[head];
+                    for (const std::pair<int, int>& edge : adj[u]) {
+                        int v = edge.first;
+                        if (dist[v] < 0) {
+                            dist[v] = dist[u] + 1;
+                            order.push_back(v);
+                        }
+                        if (dist[v] == dist[u] + 1) paths[v] += paths[u];
+                    }
+                }
+            } else {
+                typedef std::pair<long long, int> Entry;
+                std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+                heap.push({0, s});
+                while (!heap.empty()) {
+                    Entry top = heap.top();
+                    heap.pop();
+                    int u = top.second;
+                    if (top.first > dist[u]) continue;
+                    order.push_back(u);
+                    for (const std::pair<int, int>& edge : adj[u]) {
+                        int v = edge.first;
+                        long long nd = top.first + edge.second;
+                        if (dist[v] < 0 || nd < dist[v]) {
+                            dist[v] = nd;
+                            paths[v] = paths[u];
+                            heap.push({nd, v});
+                        } else if (nd == dist[v]) {
+                            paths[v] += paths[u];
+                        }
+                    }
+                }
+            }
+
+            for (size_t i = order.size(); i-- > 0;) {
+                int v = order[i];
+                for (const std::pair<int, int>& edge : adj[v]) {
+                    int w = edge.first;
+                    long long length = weighted ? edge.second : 1;
+                    if (dist[w] == dist[v] + length) dependency[v] += paths[v] / paths[w] * (1 + dependency[w]);
+                }
+                if (v != s) score[v] += dependency[v];
+            }
+            for (int v : order) {
+                dist[v] = -1;
+                paths[v] = 0;
+                dependency[v] = 0;
+            }
+        }
+    };
+
+    /**
+     * @brief An undirected graph with every edge oriented from lower to higher degree rank.
+     *
+     * Vertices are renumbered by rank: (degree, index) in increasing order. The out-list of
+     * rank r holds the ranks of its neighbours above r, sorted.
+     */
+    struct OrientedGraph {
+        std::vector<int> vertexOf; ///< Original index of every rank.
+        std::vector<long long> start; ///< Out-list of rank r is [start[r], start[r + 1]).
+        std::vector<int> target; ///< Out-neighbour ranks.
+    };
+
+    /**
+     * @brief Builds the degree-ordered orientation of an undirected graph.
+     */
+    OrientedGraph orientByDegree(const std::vector<std::vector<int>>& g) {
+        int n = g.size();
+        OrientedGraph oriented;
+        std::vector<int> degree(n, 0);
+        Parallel::forRange(0, n, 64, [&](int lo, int hi) {
+            for (int u = lo; u < hi; ++u) {
+                for (int v = 0; v < n; ++v) {
+                    if (v != u && (g[u][v] != 0 || g[v][u] != 0)) ++degree[u];
+                }
+            }
+        });
+
+        oriented.vertexOf.resize(n);
+        std::iota(oriented.vertexOf.begin(), oriented.vertexOf.end(), 0);
+        std::sort(oriented.vertexOf.begin(), oriented.vertexOf.end(), [&](int a, int b) {
+            return degree[a] != degree[b] ? degree[a] < degree[b] : a < b;
+        });
+        std::vector<int> rank(n);
+        for (int r = 0; r < n; ++r) rank[oriented.vertexOf[r]] = r;
+
+        // the orientation sends each edge to the higher rank, so count and fill per rank
+        oriented.start.assign(n + 1, 0);
+        Parallel::forRange(0, n, 64, [&](int lo, int hi) {
+            for (int r = lo; r < hi; ++r) {
+                int u = oriented.vertexOf[r];
+                long long count = 0;
+                for (int v = 0; v < n; ++v) {
+                    if (v != u && rank[v] > r && (g[u][v] != 0 || g[v][u] != 0)) ++count;
+                }
+                oriented.start[r + 1] = count;
+            }
+        });
+        for (int r = 0; r < n; ++r) oriented.start[r + 1] += oriented.start[r];
+        oriented.target.resize(oriented.start[n]);
+        Parallel::forRange(0, n, 64, [&](int lo, int hi) {
+            for (int r = lo; r < hi; ++r) {
+                int u = oriented.vertexOf[r];
+                long long e = oriented.start[r];
+                for (int v = 0; v < n; ++v) {
+                    if (v != u && rank[v] > r && (g[u][v] != 0 || g[v][u] != 0)) oriented.target[e++] = rank[v];
+                }
+                std::sort(oriented.target.begin() + oriented.start[r], oriented.target.begin() + e);
+            }
+        });
+        return oriented;
+    }
+
+    /**
+     * @brief Builds the neighbour lists of the graph treated as undirected, without self-loops.
+     */
+    std::vector<std::vector<int>> undirectedNeighbours(const std::vector<std::vector<int>>& g) {
+        int n = g.size();
+        std::vector<std::vector<int>> adj(n);
+        Parallel::forRange(0, n, 64, [&](int lo, int hi) {
+            for (int u = lo; u < hi; ++u) {
+                for (int v = 0; v < n; ++v) {
+                    if (v != u && (g[u][v] != 0 || g[v][u] != 0)) adj[u].push_back(v);
+                }
+            }
+        });
+        return adj;
+    }
+
+    /**
+     * @brief Batagelj-Zaversnik peeling: vertices sorted by degree in one array, with the
+     *        start of every degree's bucket, so a decrement is one swap.
+     */
+    void peelCores(const std::vector<std::vector<int>>& adj, Algorithms::CoreDecomposition& result) {
+        int n = adj.size();
+        std::vector<int> degree(n);
+        int maxDegree = 0;
+        for (int v = 0; v < n; ++v) {
+            degree[v] = adj[v].size();
+            maxDegree = std::max(maxDegree, degree[v]);
+        }
+
+        std::vector<int> bucketStart(maxDegree + 2, 0);
+        for (int v = 0; v < n; ++v) ++bucketStart[degree[v] + 1];
+        for (int d = 0; d <= maxDegree; ++d) bucketStart[d + 1] += bucketStart[d];
+        std::vector<int> vertex(n), position(n);
+        std::vector<int> fill(bucketStart.begin(), bucketStart.end() - 1);
+        for (int v = 0; v < n; ++v) {
+            position[v] = fill[degree[v]]++;
+            vertex[position[v]] = v;
+        }
+
+        for (int i = 0; i < n; ++i) {
+            int v = vertex[i];
+            for (int u : adj[v]) {
+                if (degree[u] <= degree[v]) continue;
+                // move u to the front of its bucket, then shrink the bucket past it
+                int du = degree[u];
+                int w = vertex[bucketStart[du]];
+                if (u != w) {
+                    std::swap(vertex[position[u]], vertex[bucketStart[du]]);
+                    position[w] = position[u];
+                    position[u] = bucketStart[du];
+                }
+                ++bucketStart[du];
+                --degree[u];
+            }
+        }
+        result.core = degree;
+        result.order = vertex;
+    }
+
+    /**
+     * @brief Level-synchronous peeling: each round removes a whole frontier in parallel.
+     *
+     * A neighbour joins the next frontier when its degree drops from k + 1 to k, which
+     * happens at most once, so no vertex is queued twice.
+     */
+    void peelCoresInRounds(const std::vector<std::vector<int>>& adj, Algorithms::CoreDecomposition& result) {
+        int n = adj.size();
+        std::vector<std::atomic<int>> degree(n);
+        std::vector<char> removed(n, 0);
+        for (int v = 0; v < n; ++v) degree[v].store(adj[v].size(), std::memory_order_relaxed);
+        result.core.assign(n, 0);
+        result.order.clear();
+        result.order.reserve(n);
+
+        int workers = Parallel::threadCount();
+        std::vector<std::vector<int>> found(workers);
+        std::vector<int> frontier;
+        int k = 0;
+        while (static_cast<int>(result.order.size()) < n) {
+            if (frontier.empty()) {
+                k = std::numeric_limits<int>::max();
+                for (int v = 0; v < n; ++v) {
+                    if (!removed[v]) k = std::min(k, degree[v].load(std::memory_order_relaxed));
+                }
+                for (int v = 0; v < n; ++v) {
+                    if (!removed[v] && degree[v].load(std::memory_order_relaxed) <= k) frontier.push_back(v);
+                }
+            }
+            for (int v : frontier) {
+                removed[v] = 1;
+                result.core[v] = k;
+                result.order.push_back(v);
+            }
+
+            int used = Parallel::forWorkers(0, frontier.size(), 256, [&](int worker, int lo, int hi) {
+                std::vector<int>& next = found[worker];
+                next.clear();
+                for (int i = lo; i < hi; ++i) {
+                    for (int u : adj[frontier[i]]) {
+                        if (removed[u]) continue;
+                        if (degree[u].fetch_sub(1, std::memory_order_relaxed) == k + 1) next.push_back(u);
+                    }
+                }
+            });
+            frontier.clear();
+            for (int worker = 0; worker < used; ++worker) {
+                frontier.insert(frontier.end(), found[worker].begin(), found[worker].end());
+            }
+        }
+    }
+
+    /**
+     * @brief Kahn's algorithm over adjacency lists.
+     *
+     * @return The order of the removed vertices; it has every vertex exactly when the graph is acyclic.
+     */
+    std::vector<int> kahnOrder(const std::vector<std::vector<std::pair<int, int>>>& adj) {
+        int n = adj.size();
+        std::vector<int> inDegree(n, 0);
+        for (int u = 0; u < n; ++u) {
+            for (const std::pair<int, int>& edge : adj[u]) ++inDegree[edge.first];
+        }
+        std::vector<int> order;
+        order.reserve(n);
+        for (int v = 0; v < n; ++v) {
+            if (inDegree[v] == 0) order.push_back(v);
+        }
+        // order doubles as the queue: everything before head has been expanded
+        for (size_t head = 0; head < order.size(); ++head) {
+            for (const std::pair<int, int>& edge : adj[order[head]]) {
+                if (--inDegree[edge.first] == 0) order.push_back(edge.first);
+            }
+        }
+        return order;
+    }
+
+    /**
+     * @brief Returns a topological order of the graph, or throws if it has a cycle.
+     */
+    std::vector<int> requireTopologicalOrder(const std::vector<std::vector<std::pair<int, int>>>& adj) {
+        std::vector<int> order = kahnOrder(adj);
+        if (order.size() != adj.size()) {
+            throw std::invalid_argument("The graph has a cycle.");
+        }
+        return order;
+    }
+
+    /**
+     * @brief Highest-label push-relabel over a residual graph of paired arcs.
+     *
+     * Arcs of vertex u occupy [start[u], start[u + 1]); mate[a] is the reverse of arc a.
+     * Every adjacent pair gets one pair of arcs, with g[u][v] and g[v][u] as capacities.
+     * Labels below n are lower bounds on the residual distance to the sink, labels from n
+     * up are n plus a lower bound on the distance back to the source.
+     */
+    struct PushRelabel {
+        int n, source, sink;
+        std::vector<long long> start;
+        std::vector<int> head;
+        std::vector<long long> mate;
+        std::vector<unsigned int> residual; ///< At most g[u][v] + g[v][u], which always fits.
+        std::vector<long long> excess;
+        std::vector<int> label;
+        std::vector<long long> current;
+        std::vector<std::vector<int>> active; ///< Active vertices by label; entries may be stale.
+        std::vector<int> countBelowN; ///< Number of vertices with each label below n, for the gap test.
+        int highest = 0;
+        long long relabelsSinceGlobal = 0;
+
+        /**
+         * @brief Calls visit(u, v) for every adjacent pair u < v.
+         *
+         * Pairs are visited in 64 x 64 tiles, so reading g[v][u] next to g[u][v] and
+         * writing the arcs of both ends stays within a few cache lines per tile.
+         */
+        template <typename Visit>
+        static void forEachPair(const std::vector<std::vector<int>>& g, const Visit& visit) {
+            int n = g.size();
+            for (int rowBlock = 0; rowBlock < n; rowBlock += 64) {
+                int rowEnd = std::min(rowBlock + 64, n);
+                for (int columnBlock = rowBlock; columnBlock < n; columnBlock += 64) {
+                    int columnEnd = std::min(columnBlock + 64, n);
+                    for (int u = rowBlock; u < rowEnd; ++u) {
+                        for (int v = std::max(columnBlock, u + 1); v < columnEnd; ++v) {
+                            if (g[u][v] != 0 || g[v][u] != 0) visit(u, v);
+                        }
+                    }
+                }
+            }
+        }
+
+        PushRelabel(const std::vector<std::vector<int>>& g, int s, int t) : n(g.size()), source(s), sink(t) {
+            start.assign(n + 1, 0);
+            forEachPair(g, [&](int u, int v) {
+                ++start[u + 1];
+                ++start[v + 1];
+            });
+            for (int u = 0; u < n; ++u) start[u + 1] += start[u];
+            head.resize(start[n]);
+            mate.resize(start[n]);
+            residual.resize(start[n]);
+            std::vector<long long> fill(start.begin(), start.end() - 1);
+            forEachPair(g, [&](int u, int v) {
+                long long a = fill[u]++, b = fill[v]++;
+                head[a] = v;
+                head[b] = u;
+                mate[a] = b;
+                mate[b] = a;
+                residual[a] = g[u][v];
+                residual[b] = g[v][u];
+            });
+            excess.assign(n, 0);
+            label.assign(n, 0);
+            current.assign(start.begin(), start.end() - 1);
+            active.assign(2 * n + 1, std::vector<int>());
+            countBelowN.assign(n, 0);
+        }
+
+        void activate(int v) {
+            if (v == source || v == sink || label[v] >= 2 * n) return;
+            active[label[v]].push_back(v);
+            highest = std::max(highest, label[v]);
+        }
+
+        void setLabel(int v, int value) {
+            if (label[v] < n) --countBelowN[label[v]];
+            label[v] = value;
+            if (value < n) ++countBelowN[value];
+        }
+
+        /**
+         * @brief Backward BFS over residual arcs from the sink, then from the source.
+         */
+        void globalRelabel() {
+            std::fill(label.begin(), label.end(), 2 * n);
+            std::fill(countBelowN.begin(), countBelowN.end(), 0);
+            std::vector<int> queue;
+            queue.reserve(n);
+            for (int root : {sink, source}) {
+                int base = root == sink ? 0 : n;
+                label[root] = base;
+                queue.clear();
+                queue.push_back(root);
+                for (size_t i = 0; i < queue.size(); ++i) {
+                    int u = queue[i];
+                    for (long long a = start[u]; a < start[u + 1]; ++a) {
+                        int v = head[a];
+                        // v can push to u if the reverse arc v->u has residual capacity
+                        if (label[v] == 2 * n && residual[mate[a]] > 0) {
+                            label[v] = label[u] + 1;
+                            queue.push_back(v);
+                        }
+                    }
+                }
+            }
+            label[source] = n;
+            for (std::vector<int>& bucket : active) bucket.clear();
+            highest = 0;
+            for (int v = 0; v < n; ++v) {
+                if (label[v] < n) ++countBelowN[label[v]];
+                current[v] = start[v];
+                if (excess[v] > 0) activate(v);
+            }
+            relabelsSinceGlobal = 0;
+        }
+
+        /**
+         * @brief Lifts every vertex with a label in (gap, n) to n: none of them can reach the sink.
+         */
+        void liftAboveGap(int gap) {
+            for (int v = 0; v < n; ++v) {
+                if (label[v] > gap && label[v] < n) {
+                    setLabel(v, n);
+                    current[v] = start[v];
+                    if (excess[v] > 0) activate(v);
+                }
+            }
+        }
+
+        void relabel(int u) {
+            int old = label[u];
+            int lowest = 2 * n;
+            for (long long a = start[u]; a < start[u + 1]; ++a) {
+                if (residual[a] > 0) lowest = std::min(lowest, label[head[a]] + 1);
+            }
+            setLabel(u, lowest);
+            current[u] = start[u];
+            ++relabelsSinceGlobal;
+            if (old < n && countBelowN[old] == 0) liftAboveGap(old);
+        }
+
+        void discharge(int u) {
+            while (excess[u] > 0 && label[u] < 2 * n) {
+                if (current[u] == start[u + 1]) {
+                    relabel(u);
+                    continue;
+                }
+                long long a = current[u];
+                int v = head[a];
+                if (residual[a] > 0 && label[u] == label[v] + 1) {
+                    long long delta = std::min<long long>(excess[u], residual[a]);
+                    residual[a] -= static_cast<unsigned int>(delta);
+                    residual[mate[a]] += static_cast<unsigned int>(delta);
+                    excess[u] -= delta;
+                    if (excess[v] == 0) {
+                        excess[v] = delta;
+                        activate(v);
+                    } else {
+                        excess[v] += delta;
+                    }
+                } else {
+                    ++current[u];
+                }
+            }
+        }
+
+        long long run() {
+            for (long long a = start[source]; a < start[source + 1]; ++a) {
+                long long delta = residual[a];
+                if (delta == 0) continue;
+                residual[a] = 0;
+                residual[mate[a]] += static_cast<unsigned int>(delta);
+                excess[head[a]] += delta;
+                excess[source] -= delta;
+            }
+            globalRelabel();
+            while (highest >= 0) {
+                if (active[highest].empty()) {
+                    --highest;
+                    continue;
+                }
+                int u = active[highest].back();
+                active[highest].pop_back();
+                if (label[u] != highest || excess[u] == 0) continue;
+                discharge(u);
+                if (relabelsSinceGlobal >= n) globalRelabel();
+            }
+            return excess[sink];
+        }
+    };
+
+    /**
+     * @brief Two-colors the graph, treated as undirected, by BFS from each uncolored vertex.
+     *
+     * @param g The adjacency matrix.
+     * @param side Receives 1 (side A) or -1 (side B) for every vertex; each BFS starts on side A.
+     * @return bool True if the graph is bipartite.
+     */
+    bool twoColoring(const std::vector<std::vector<int>>& g, std::vector<int>& side) {
+        int n = g.size();
+        side.assign(n, 0);
+        std::vector<int> queue;
+        queue.reserve(n);
+        for (int start = 0; start < n; ++start) {
+            if (side[start] != 0) continue;
+            side[start] = 1;
+            queue.clear();
+            queue.push_back(start);
+            for (size_t head = 0; head < queue.size(); ++head) {
+                int u = queue[head];
+                for (int v = 0; v < n; ++v) {
+                    if (g[u][v] == 0 && g[v][u] == 0) continue;
+                    if (side[v] == side[u]) return false;
+                    if (side[v] == 0) {
+                        side[v] = -side[u];
+                        queue.push_back(v);
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief A weighted undirected graph whose vertices are groups of original vertices.
+     */
+    struct ContractedGraph {
+        std::vector<std::vector<long long>> weight; ///< Total weight between two groups.
+        std::vector<std::vector<int>> members; ///< Original vertices of every group.
+    };
+
+    /**
+     * @brief Stoer-Wagner on a contracted graph.
+     *
+     * Each phase grows a set from group 0, always adding the group most tightly connected
+     * to it (a linear scan of the keys, which is optimal on a dense matrix). The last group
+     * added, cut off from all others, is a candidate; it is then merged into the one
+     * added before it.
+     *
+     * @return The cut value and the members of one side.
+     */
+    std::pair<long long, std::vector<int>> stoerWagner(ContractedGraph graph) {
+        std::vector<std::vector<long long>>& w = graph.weight;
+        std::vector<int> alive(w.size());
+        std::iota(alive.begin(), alive.end(), 0);
+        std::pair<long long, std::vector<int>> best(std::numeric_limits<long long>::max(), std::vector<int>());
+        std::vector<long long> key(w.size());
+        std::vector<char> added(w.size());
+
+        while (alive.size() > 1) {
+            int k = alive.size();
+            for (int i = 0; i < k; ++i) {
+                key[alive[i]] = 0;
+                added[alive[i]] = 0;
+            }
+            int previous = -1, last = alive[0];
+            for (int step = 0; step < k; ++step) {
+                int next = -1;
+                for (int v : alive) {
+                    if (!added[v] && (next == -1 || key[v] > key[next])) next = v;
+                }
+                added[next] = 1;
+                previous = last;
+                last = next;
+                for (int v : alive) {
+                    if (!added[v]) key[v] += w[next][v];
+                }
+            }
+            if (key[last] < best.first) best = {key[last], graph.members[last]};
+
+            // merge the last group into the one added before it
+            for (int v : alive) {
+                w[previous][v] += w[last][v];
+                w[v][previous] = w[previous][v];
+            }
+            w[previous][previous] = 0;
+            graph.members[previous].insert(graph.members[previous].end(), graph.members[last].begin(),
+                                           graph.members[last].end());
+            alive.erase(std::find(alive.begin(), alive.end(), last));
+        }
+        return best;
+    }
+
+    /**
+     * @brief Contracts random edges, each picked with probability proportional to its weight,
+     *        until target groups remain (or no edge is left).
+     */
+    void contractRandomly(ContractedGraph& graph, int target, std::mt19937_64& random) {
+        std::vector<std::vector<long long>>& w = graph.weight;
+        int k = w.size();
+        std::vector<long long> degree(k, 0);
+        for (int u = 0; u < k; ++u) degree[u] = std::accumulate(w[u].begin(), w[u].end(), 0LL);
+
+        while (k > target) {
+            long long total = std::accumulate(degree.begin(), degree.begin() + k, 0LL);
+            if (total == 0) break;
+            long long r = std::uniform_int_distribution<long long>(0, total - 1)(random);
+            int u = 0;
+            while (r >= degree[u]) r -= degree[u++];
+            r = std::uniform_int_distribution<long long>(0, degree[u] - 1)(random);
+            int v = 0;
+            while (r >= w[u][v]) r -= w[u][v++];
+
+            // merge v into u, then move the last group into v's slot
+            degree[u] += degree[v] - 2 * w[u][v];
+            for (int x = 0; x < k; ++x) {
+                w[u][x] += w[v][x];
+                w[x][u] = w[u][x];
+            }
+            w[u][u] = 0;
+            graph.members[u].insert(graph.members[u].end(), graph.members[v].begin(), graph.members[v].end());
+            int lastIndex = k - 1;
+            if (v != lastIndex) {
+                for (int x = 0; x < k; ++x) {
+                    w[v][x] = w[lastIndex][x];
+                    w[x][v] = w[v][x];
+                }
+                w[v][v] = 0;
+                degree[v] = degree[lastIndex];
+                graph.members[v].swap(graph.members[lastIndex]);
+            }
+            --k;
+            for (int x = 0; x < k; ++x) w[x].resize(k);
+            w.resize(k);
+            degree.resize(k);
+            graph.members.resize(k);
+        }
+    }
+
+    /**
+     * @brief One Karger-Stein trial: contract to n / sqrt(2) + 1 twice and recurse on both copies.
+     *
+     * Graphs of at most 32 groups are solved exactly by Stoer-Wagner instead.
+     */
+    std::pair<long long, std::vector<int>> kargerStein(const ContractedGraph& graph, std::mt19937_64& random) {
+        int k = graph.weight.size();
+        // Stoer-Wagner is exact and cheap on small graphs, and stopping here saves most of the recursion
+        if (k <= 32) return stoerWagner(graph);
+        int target = static_cast<int>(std::ceil(1 + k / std::sqrt(2.0)));
+        std::pair<long long, std::vector<int>> best(std::numeric_limits<long long>::max(), std::vector<int>());
+        for (int copy = 0; copy < 2; ++copy) {
+            ContractedGraph contracted = graph;
+            contractRandomly(contracted, target, random);
+            // no edge left to contract: the groups are already apart
+            if (static_cast<int>(contracted.weight.size()) > target) return {0, contracted.members[0]};
+            std::pair<long long, std::vector<int>> found = kargerStein(contracted, random);
+            if (found.first < best.first) best = found;
+        }
+        return best;
+    }
+
+    /**
+     * @brief The neighbourhood of one vertex, re-indexed as bit rows for clique search.
+     *
+     * Local vertex i is vertex[i]; rows hold the adjacency among them, words per row.
+     * Each thread owns one and reuses its storage (and the per-depth sets) for every vertex.
+     */
+    struct CliqueSearch {
+        std::vector<int> vertex;
+        std::vector<uint64_t> rows;
+        int words = 0;
+        std::deque<std::vector<uint64_t>> levels; ///< Scratch sets, three per recursion depth; a deque so references survive growth.
+        std::vector<int> clique; ///< Local vertices of the current clique.
+
+        const uint64_t* row(int i) const { return rows.data() + static_cast<size_t>(i) * words; }
+
+        /**
+         * @brief Loads the neighbours of v into local indices and marks which come later in the order.
+         */
+        void load(const BitMatrix& adjacency, const std::vector<int>& neighbours, const std::vector<int>& place,
+                  int v, std::vector<uint64_t>& later, std::vector<uint64_t>& earlier) {
+            vertex = neighbours;
+            int d = vertex.size();
+            words = (d + 63) / 64;
+            rows.assign(static_cast<size_t>(d) * words, 0);
+            for (int i = 0; i < d; ++i) {
+                uint64_t* r = rows.data() + static_cast<size_t>(i) * words;
+                for (int j = 0; j < d; ++j) {
+                    if (adjacency.get(vertex[i], vertex[j])) r[j >> 6] |= uint64_t(1) << (j & 63);
+                }
+            }
+            later.assign(words, 0);
+            earlier.assign(words, 0);
+            for (int i = 0; i < d; ++i) {
+                (place[vertex[i]] > place[v] ? later : earlier)[i >> 6] |= uint64_t(1) << (i & 63);
+            }
+            clique.clear();
+        }
+
+        std::vector<uint64_t>& scratch(int depth, int which) {
+            size_t index = static_cast<size_t>(depth) * 3 + which;
+            if (levels.size() <= index) levels.resize(index + 1);
+            levels[index].assign(words, 0);
+            return levels[index];
+        }
+
+        static int count(const std::vector<uint64_t>& set) {
+            int total = 0;
+            for (uint64_t word : set) total += __builtin_popcountll(word);
+            return total;
+        }
+
+        /**
+         * @brief Bron-Kerbosch with Tomita pivoting; calls report() for every maximal clique.
+         */
+        template <typename Report>
+        void enumerate(std::vector<uint64_t>& candidates, std::vector<uint64_t>& excluded, int depth,
+                       const Report& report) {
+            bool emptyP = true, emptyX = true;
+            for (int w = 0; w < words; ++w) {
+                emptyP = emptyP && candidates[w] == 0;
+                emptyX = emptyX && excluded[w] == 0;
+            }
+            if (emptyP) {
+                if (emptyX) report(clique);
+                return;
+            }
+
+            // the pivot covers the most candidates, so only the others are branched on
+            int pivot = -1, covered = -1;
+            for (int w = 0; w < words; ++w) {
+                for (uint64_t bits = candidates[w] | excluded[w]; bits; bits &= bits - 1) {
+                    int u = w * 64 + __builtin_ctzll(bits);
+                    const uint64_t* r = row(u);
+                    int c = 0;
+                    for (int x = 0; x < words; ++x) c += __builtin_popcountll(candidates[x] & r[x]);
+                    if (c > covered) {
+                        covered = c;
+                        pivot = u;
+                    }
+                }
+            }
+            std::vector<uint64_t>& branch = scratch(depth, 0);
+            const uint64_t* pivotRow = row(pivot);
+            for (int w = 0; w < words; ++w) branch[w] = candidates[w] & ~pivotRow[w];
+
+            for (int w = 0; w < words; ++w) {
+                for (uint64_t bits = branch[w]; bits; bits &= bits - 1) {
+                    int v = w * 64 + __builtin_ctzll(bits);
+                    const uint64_t* r = row(v);
+                    std::vector<uint64_t>& nextP = scratch(depth, 1);
+                    std::vector<uint64_t>& nextX = scratch(depth, 2);
+                    for (int x = 0; x < words; ++x) {
+                        nextP[x] = candidates[x] & r[x];
+                        nextX[x] = excluded[x] & r[x];
+                    }
+                    clique.push_back(v);
+                    enumerate(nextP, nextX, depth + 1, report);
+                    clique.pop_back();
+                    candidates[w] &= ~(uint64_t(1) << (v & 63));
+                    excluded[w] |= uint64_t(1) << (v & 63);
+                }
+            }
+        }
+
+        /**
+         * @brief Branch and bound for a clique larger than best, bounded by greedy colorings.
+         *
+         * Candidates are colored one class at a time (a class is an independent set taken
+         * greedily by bit operations) and tried from the highest color down; a candidate
+         * of color c can extend the clique by at most c vertices.
+         */
+        void maximum(std::vector<uint64_t>& candidates, int depth, std::atomic<int>& best, std::vector<int>& found) {
+            std::vector<int> order, color;
+            std::vector<uint64_t>& uncolored = scratch(depth, 0);
+            std::vector<uint64_t>& colorClass = scratch(depth, 1);
+            uncolored = candidates;
+            for (int c = 1; count(uncolored) > 0; ++c) {
+                colorClass = uncolored;
+                for (int w = 0; w < words; ++w) {
+                    while (colorClass[w]) {
+                        int v = w * 64 + __builtin_ctzll(colorClass[w]);
+                        const uint64_t* r = row(v);
+                        for (int x = 0; x < words; ++x) colorClass[x] &= ~r[x];
+                        colorClass[w] &= ~(uint64_t(1) << (v & 63));
+                        uncolored[w] &= ~(uint64_t(1) << (v & 63));
+                        order.push_back(v);
+                        color.push_back(c);
+                    }
+                }
+            }
+
+            for (int i = static_cast<int>(order.size()) - 1; i >= 0; --i) {
+                // the neighbourhood's own vertex, the clique so far and at most color[i] candidates
+                if (1 + static_cast<int>(clique.size()) + color[i] <= best.load(std::memory_order_relaxed)) return;
+                int v = order[i];
+                const uint64_t* r = row(v);
+                std::vector<uint64_t>& next = scratch(depth, 2);
+                bool empty = true;
+                for (int x = 0; x < words; ++x) {
+                    next[x] = candidates[x] & r[x];
+                    empty = empty && next[x] == 0;
+                }
+                clique.push_back(v);
+                if (empty) {
+                    int total = 1 + static_cast<int>(clique.size());
+                    int seen = best.load(std::memory_order_relaxed);
+                    while (total > seen && !best.compare_exchange_weak(seen, total, std::memory_order_relaxed)) {
+                    }
+                    if (clique.size() > found.size()) {
+                        found.clear();
+                        for (int local : clique) found.push_back(vertex[local]);
+                    }
+                } else {
+                    maximum(next, depth + 1, best, found);
+                }
+                clique.pop_back();
+                candidates[v >> 6] &= ~(uint64_t(1) << (v & 63));
+            }
+        }
+    };
+
+    /**
+     * @brief The packed undirected adjacency (no self-loops) and a degeneracy ordering.
+     */
+    void cliqueSetup(const std::vector<std::vector<int>>& g, BitMatrix& adjacency,
+                     std::vector<std::vector<int>>& neighbours, std::vector<int>& order, std::vector<int>& place) {
+        int n = g.size();
+        neighbours = undirectedNeighbours(g);
+        adjacency = BitMatrix(n);
+        for (int u = 0; u < n; ++u) {
+            for (int v : neighbours[u]) adjacency.set(u, v, true);
+        }
+        Algorithms::CoreDecomposition cores;
+        peelCores(neighbours, cores);
+        order = cores.order;
+        place.assign(n, 0);
+        for (int i = 0; i < n; ++i) place[order[i]] = i;
+    }
+
+    /**
+     * @brief Single-source searches over the undirected graph, reusing their arrays.
+     */
+    struct DistanceSweep {
+        std::vector<std::vector<std::pair<int, int>>> adj; ///< Undirected (neighbour, weight) lists.
+        bool weighted;
+        std::vector<long long> dist; ///< Distance from the last source, -1 if unreached.
+        std::vector<int> parent; ///< Previous vertex on a shortest path from the last source.
+        std::vector<int> reached; ///< Vertices reached by the last search, in order of distance.
+
+        DistanceSweep(const std::vector<std::vector<int>>& g, bool weighted) : weighted(weighted) {
+            int n = g.size();
+            std::vector<std::vector<int>> neighbours = undirectedNeighbours(g);
+            adj.resize(n);
+            for (int u = 0; u < n; ++u) {
+                for (int v : neighbours[u]) {
+                    int w = undirectedWeight(g, u, v);
+                    if (weighted && w < 0) throw std::invalid_argument("Weighted distances require positive edge weights.");
+                    adj[u].push_back({v, w});
+                }
+            }
+            dist.assign(n, -1);
+            parent.assign(n, -1);
+        }
+
+        /**
+         * @brief Searches from s and returns its eccentricity.
+         */
+        long long run(int s) {
+            for (int v : reached) dist[v] = -1;
+            reached.clear();
+            dist[s] = 0;
+            parent[s] = -1;
+            if (!weighted) {
+                reached.push_back(s);
+                for (size_t head = 0; head < reached.size(); ++head) {
+                    int u = reached[head];
+                    for (const std::pair<int, int>& edge : adj[u]) {
+                        int v = edge.first;
+                        if (dist[v] != -1) continue;
+                        dist[v] = dist[u] + 1;
+                        parent[v] = u;
+                        reached.push_back(v);
+                    }
+                }
+            } else {
+                typedef std::pair<long long, int> Entry;
+                std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+                heap.push({0, s});
+                while (!heap.empty()) {
+                    Entry top = heap.top();
+                    heap.pop();
+                    int u = top.second;
+                    if (top.first > dist[u]) continue;
+                    reached.push_back(u);
+                    for (const std::pair<int, int>& edge : adj[u]) {
+                        int v = edge.first;
+                        long long nd = top.first + edge.second;
+                        if (dist[v] == -1 || nd < dist[v]) {
+                            dist[v] = nd;
+                            parent[v] = u;
+                            heap.push({nd, v});
+                        }
+                    }
+                }
+            }
+            return dist[reached.back()];
+        }
+    };
+
+    /**
+     * @brief iFUB on the component of start, for unit edge lengths.
+     */
+    long long componentDiameter(DistanceSweep& sweep, int start) {
+        // double sweep: the far end a of start, then the far end b of a; the middle of a-b is central
+        sweep.run(start);
+        int a = sweep.reached.back();
+        long long lower = sweep.run(a);
+        int middle = sweep.reached.back();
+        for (long long step = 0; step < lower / 2; ++step) middle = sweep.parent[middle];
+
+        long long centre = sweep.run(middle);
+        lower = std::max(lower, centre);
+        std::vector<int> fringe = sweep.reached;
+        std::vector<long long> level(fringe.size());
+        for (size_t i = 0; i < fringe.size(); ++i) level[i] = sweep.dist[fringe[i]];
+
+        // every pair with both ends at levels <= i - 1 is at most 2(i - 1) apart
+        size_t next = fringe.size();
+        for (long long i = centre; 2 * i > lower && i > 0; --i) {
+            while (next > 0 && level[next - 1] == i) lower = std::max(lower, sweep.run(fringe[--next]));
+            if (lower > 2 * (i - 1)) break;
+        }
+        return lower;
+    }
+
+    /**
+     * @brief Multi-source bit-parallel BFS (MS-BFS) over out-neighbour lists.
+     *
+     * Every vertex holds `words` 64-bit words with one bit per source of the batch: the
+     * sources that have seen it, that reach it in the current level, and that reach it in
+     * the next one.
+     */
+    struct MultiSourceBfs {
+        static const int MAX_WORDS = 4; ///< At most 256 sources per batch.
+
+        const std::vector<std::vector<int>>& adj;
+        int words = 0;
+        std::vector<unsigned long long> seen, visit, visitNext;
+        std::vector<int> frontier, nextFrontier; ///< Vertices with a non-zero visit (visitNext) mask.
+
+        explicit MultiSourceBfs(const std::vector<std::vector<int>>& adj) : adj(adj) {}
+
+        /**
+         * @brief Runs the BFS from sources[0..count), calling found(v, level, bit, from) for
+         *        every source (by index in the batch) that reaches v at that level, v != source;
+         *        from is the vertex of the previous level that delivered it first. The
+         *        sources must be distinct.
+         */
+        template <typename Found>
+        void run(const int* sources, int count, const Found& found) {
+            int n = adj.size();
+            words = (count + 63) / 64;
+            seen.assign(static_cast<size_t>(n) * words, 0);
+            visit.assign(static_cast<size_t>(n) * words, 0);
+            visitNext.assign(static_cast<size_t>(n) * words, 0);
+            frontier.clear();
+            for (int i = 0; i < count; ++i) {
+                size_t cell = static_cast<size_t>(sources[i]) * words + i / 64;
+                unsigned long long bit = 1ULL << (i % 64);
+                frontier.push_back(sources[i]);
+                seen[cell] |= bit;
+                visit[cell] |= bit;
+            }
+
+            for (long long level = 1; !frontier.empty(); ++level) {
+                nextFrontier.clear();
+                for (int u : frontier) {
+                    const unsigned long long* from = &visit[static_cast<size_t>(u) * words];
+                    for (int v : adj[u]) {
+                        unsigned long long* to = &visitNext[static_cast<size_t>(v) * words];
+                        unsigned long long* done = &seen[static_cast<size_t>(v) * words];
+                        bool wasEmpty = true, grew = false;
+                        for (int w = 0; w < words; ++w) {
+                            wasEmpty = wasEmpty && to[w] == 0;
+                            unsigned long long fresh = from[w] & ~done[w] & ~to[w];
+                            if (fresh == 0) continue;
+                            to[w] |= fresh;
+                            grew = true;
+                            for (unsigned long long bits = fresh; bits != 0; bits &= bits - 1) {
+                                found(v, level, w * 64 + __builtin_ctzll(bits), u);
+                            }
+                        }
+                        if (wasEmpty && grew) nextFrontier.push_back(v);
+                    }
+                }
+                for (int u : frontier) std::fill_n(&visit[static_cast<size_t>(u) * words], words, 0ULL);
+                for (int v : nextFrontier) {
+                    unsigned long long* fresh = &visitNext[static_cast<size_t>(v) * words];
+                    unsigned long long* done = &seen[static_cast<size_t>(v) * words];
+                    unsigned long long* into = &visit[static_cast<size_t>(v) * words];
+                    for (int w = 0; w < words; ++w) {
+                        done[w] |= fresh[w];
+                        into[w] = fresh[w];
+                        fresh[w] = 0;
+                    }
+                }
+                frontier.swap(nextFrontier);
+            }
+        }
+    };
+
+    /**
+     * @brief Runs MS-BFS from every vertex, batches split across threads; found(source, v, level, from).
+     *
+     * Each source belongs to one batch, so everything indexed by source is written by one thread.
+     */
+    template <typename Found>
+    int multiSourceBfsAll(const std::vector<std::vector<int>>& adj, const Found& found) {
+        int n = adj.size();
+        const int batch = MultiSourceBfs::MAX_WORDS * 64;
+        int batches = (n + batch - 1) / batch;
+        std::vector<int> sources(n);
+        std::iota(sources.begin(), sources.end(), 0);
+        return Parallel::forWorkers(0, batches, 1, [&](int, int lo, int hi) {
+            MultiSourceBfs bfs(adj);
+            for (int b = lo; b < hi; ++b) {
+                int first = b * batch;
+                int count = std::min(batch, n - first);
+                bfs.run(&sources[first], count, [&](int v, long long level, int bit, int from) {
+                    found(first + bit, v, level, from);
+                });
+            }
+        });
+    }
+
+    /**
+     * @brief Builds the out-neighbour lists of the graph, without self-loops and weights.
+     */
+    std::vector<std::vector<int>> outNeighbours(const std::vector<std::vector<int>>& g) {
+        int n = g.size();
+        std::vector<std::vector<int>> adj(n);
+        Parallel::forRange(0, n, 64, [&](int lo, int hi) {
+            for (int u = lo; u < hi; ++u) {
+                for (int v = 0; v < n; ++v) {
+                    if (v != u && g[u][v] != 0) adj[u].push_back(v);
+                }
+            }
+        });
+        return adj;
+    }
+
+    /**
+     * @brief Spur searches of Yen's algorithm: A* towards a fixed target with exact
+     *        potentials, a vertex ban stamped per search and a list of banned spur edges.
+     *
+     * The potentials come with the tree of shortest routes to the target. Once a popped
+     * vertex's route in that tree avoids every ban, the route finishes the search.
+     */
+    struct SpurSearch {
+        typedef std::pair<long long, int> Entry;
+
+        const SparseMatrix& adjacency;
+        int target;
+        std::vector<long long> toTarget; ///< Distance to target in the whole graph, -1 if unreachable.
+        std::vector<int> towards; ///< Next vertex on a shortest route to target in the whole graph.
+        std::vector<long long> dist; ///< Distance from the spur vertex, valid where seenAt == epoch.
+        std::vector<int> parent;
+        std::vector<int> seenAt, bannedAt, checkedAt; ///< Search epoch that reached / banned / checked each vertex.
+        std::vector<char> clear; ///< Whether the route from a checked vertex avoids the bans.
+        std::vector<int> bannedNext; ///< Vertices the spur vertex may not step to.
+        std::vector<Entry> heap;
+        std::vector<int> walk;
+        int epoch = 0;
+
+        SpurSearch(const SparseMatrix& adjacency, int target)
+            : adjacency(adjacency), target(target), toTarget(adjacency.getSize(), -1), towards(adjacency.getSize(), -1),
+              dist(adjacency.getSize()), parent(adjacency.getSize()), seenAt(adjacency.getSize(), 0),
+              bannedAt(adjacency.getSize(), 0), checkedAt(adjacency.getSize(), 0), clear(adjacency.getSize(), 0) {
+            // Dijkstra to the target over the reversed edges gives the potentials
+            SparseMatrix reverse = adjacency.transpose();
+            toTarget[target] = 0;
+            heap.push_back({0, target});
+            while (!heap.empty()) {
+                std::pop_heap(heap.begin(), heap.end(), std::greater<Entry>());
+                Entry top = heap.back();
+                heap.pop_back();
+                int u = top.second;
+                if (top.first > toTarget[u]) continue;
+                for (long long e = reverse.rowBegin(u); e < reverse.rowEnd(u); ++e) {
+                    int v = reverse.column(e);
+                    long long nd = top.first + reverse.value(e);
+                    if (toTarget[v] == -1 || nd < toTarget[v]) {
+                        toTarget[v] = nd;
+                        towards[v] = u;
+                        heap.push_back({nd, v});
+                        std::push_heap(heap.begin(), heap.end(), std::greater<Entry>());
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Starts a new search: clears the bans of the previous one in O(1).
+         */
+        void reset() {
+            ++this->epoch;
+            this->bannedNext.clear();
+        }
+
+        /**
+         * @brief Checks whether the shortest route from v to the target avoids the banned
+         *        vertices and source; every vertex is walked once per search.
+         */
+        bool clearRoute(int v, int source) {
+            walk.clear();
+            bool ok;
+            for (int at = v;; at = towards[at]) {
+                if (checkedAt[at] == epoch) {
+                    ok = clear[at];
+                    break;
+                }
+                walk.push_back(at);
+                if (at == source || bannedAt[at] == epoch) {
+                    ok = false;
+                    break;
+                }
+                if (at == target) {
+                    ok = true;
+                    break;
+                }
+            }
+            for (int w : walk) {
+                checkedAt[w] = epoch;
+                clear[w] = ok;
+            }
+            return ok;
+        }
+
+        /**
+         * @brief Finds the cheapest path from source to the target avoiding the bans.
+         * @param source The spur vertex.
+         * @param costs Receives the distance from source of every vertex on the path.
+         * @return The vertices of the path, empty if there is none.
+         */
+        std::vector<int> search(int source, std::vector<long long>& costs) {
+            std::vector<int> path;
+            costs.clear();
+            if (toTarget[source] == -1 || bannedAt[source] == epoch) return path;
+            heap.clear();
+            seenAt[source] = epoch;
+            dist[source] = 0;
+            parent[source] = -1;
+            heap.push_back({toTarget[source], source});
+            int joined = -1;
+            while (!heap.empty()) {
+                std::pop_heap(heap.begin(), heap.end(), std::greater<Entry>());
+                Entry top = heap.back();
+                heap.pop_back();
+                int u = top.second;
+                if (top.first - toTarget[u] > dist[u]) continue;
+                if (u == target || (u != source && clearRoute(u, source))) {
+                    joined = u;
+                    break;
+                }
+                for (long long e = adjacency.rowBegin(u); e < adjacency.rowEnd(u); ++e) {
+                    int v = adjacency.column(e);
+                    if (toTarget[v] == -1 || bannedAt[v] == epoch) continue;
+                    if (u == source && std::find(bannedNext.begin(), bannedNext.end(), v) != bannedNext.end()) continue;
+                    long long nd = dist[u] + adjacency.value(e);
+                    if (seenAt[v] != epoch || nd < dist[v]) {
+                        seenAt[v] = epoch;
+                        dist[v] = nd;
+                        parent[v] = u;
+                        heap.push_back({nd + toTarget[v], v});
+                        std::push_heap(heap.begin(), heap.end(), std::greater<Entry>());
+                    }
+                }
+            }
+            if (joined == -1) return path;
+            for (int at = joined; at != -1; at = parent[at]) path.push_back(at);
+            std::reverse(path.begin(), path.end());
+            for (int v : path) costs.push_back(dist[v]);
+            long long total = dist[joined] + toTarget[joined];
+            for (int at = joined; at != target;) {
+                at = towards[at];
+                path.push_back(at);
+                costs.push_back(total - toTarget[at]);
+            }
+            return path;
+        }
+    };
+}
+
 namespace Algorithms {
 
     /**
-     * @brief Checks if the given graph is connected.
-     * 
+     * @brief Checks if the given graph is connected.
+     * 
+     * @param graph The Graph object representing the graph.
+     * @return int Returns 1 if the graph is connected, 0 otherwise.
+     */
+    int isConnected(Graph graph) {
+        const std::vector<std::vector<int>> g = graph.getMatrix();
+        int n = g.size();
+        if (n == 0) return 1;
+        std::vector<bool> visited(n, false);
+        std::stack<int> stk;
+        // Start DFS from vertex 0
+        stk.push(0);
+        visited[0] = true;
+        int counter = 1;
+        while (!stk.empty()) {
+            int current = stk.top();
+            stk.pop();
+            for (int i = 0; i < n; i++) {
+                if (g[current][i] != 0 && !visited[i]) {
+                    visited[i] = true;
+                    stk.push(i);
+                    counter++;
+                }
+            }
+        }
+        if (counter == n) return 1;
+        return 0;
+    }
+
+    /**
+     * @brief Checks if the given graph contains a cycle.
+     * 
+     * @param graph The Graph object representing the graph.
+     * @return bool Returns true if the graph contains a cycle, false otherwise.
+     */
+    bool isContainsCycle(Graph graph) {
+        const std::vector<std::vector<int>> g = graph.getMatrix();
+        int n = g.size();
+        if (n <= 1) return false;
+        std::vector<bool> visited(n, false);
+        std::stack<std::pair<int, int>> stk;
+
+        for (int startVer = 0; startVer < n; startVer++) {
+            if (visited[startVer]) continue;
+            stk.push({startVer, -1});
+
+            while (!stk.empty()) {
+                int current = stk.top().first;
+                int parent = stk.top().second;
+                stk.pop();
+                if (visited[current]) continue;
+                visited[current] = true;
+                for (int i = 0; i < n; i++) {
+                    if (g[current][i] != 0) {
+                        if (visited[i] && i != parent) {
+                            return true; // Found a cycle
+                        }
+                        if (!visited[i]) {
+                            stk.push({i, current}); // Push the node and its parent
+                        }
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Checks if the given graph is bipartite and returns the partitioning.
+     * 
+     * @param graph The Graph object representing the graph.
+     * @return std::string Returns a string indicating if the graph is bipartite and its partitioning.
+     */
+    std::string isBipartite(Graph graphObj){
+        const std::vector<std::vector<int>> g = graphObj.getMatrix();
+        int n=g.size();
+        if(n==0)return "The graph is bipartite: A={}, B={}";
+        if(n==1)return "The graph is bipartite: A={0}, B={}";
+        if(n==2)return "The graph is bipartite: A={0}, B={1}";
+        std::vector<int> side;
+        if(!twoColoring(g,side))return "0";
+        std::string sideA = "";
+        std::string sideB = "";
+        for(int i=0;i<n;i++){
+            std::string next = std::to_string(i);
+            if(side[i]==1){
+                if(!sideA.empty())sideA+=", ";
+                sideA+=next;
+            }
+            else{
+                if(!sideB.empty())sideB+=", ";
+                sideB+=next;
+            }
+        }
+        std::string ans = "The graph is bipartite: A={"+sideA+"}, B={"+sideB+"}";
+        return ans;
+    }
+
+    /**
+     * @brief Finds the shortest path between two vertices in the graph using Bellman-Ford.
+     * 
+     * @param graph The Graph object representing the graph.
+     * @param start The starting vertex.
+     * @param end The ending vertex.
+     * @return std::string Returns a string representing the shortest path between the vertices.
+     */
+    std::string shortestPath(Graph graph, int start, int end) {
+    const std::vector<std::vector<int>> g = graph.getMatrix();
+    int n = g.size();
+    if (start >= n || end >= n || start < 0 || end < 0) return "Input vertices don't match Graph size.";
+    if (end == start) return std::to_string(start);
+
+    std::vector<int> VerDist(n, std::numeric_limits<int>::max());
+    std::vector<int> reconstruct(n, -1);
+    VerDist[start] = 0;
+
+    // Bellman-Ford algorithm
+    for (int i = 0; i < n - 1; ++i) {
+        for (int u = 0; u < n; ++u) {
+            for (int v = 0; v < n; ++v) {
+                if (g[u][v] != 0 && VerDist[u] != std::numeric_limits<int>::max() && VerDist[u] + g[u][v] < VerDist[v]) {
+                    VerDist[v] = VerDist[u] + g[u][v];
+                    reconstruct[v] = u;
+                }
+            }
+        }
+    }
+
+    // Check for negative-weight cycles
+    for (int u = 0; u < n; ++u) {
+        for (int v = 0; v < n; ++v) {
+            if (g[u][v] != 0 && VerDist[u] != std::numeric_limits<int>::max() && VerDist[u] + g[u][v] < VerDist[v]) {
+                return "Graph contains a negative-weight cycle.";
+            }
+        }
+    }
+
+    if (VerDist[end] == std::numeric_limits<int>::max()) return "-1";
+    
+    // Reconstruct the path from endVer back to startVer
+    std::string ans;
+    for (int at = end; at != -1; at = reconstruct[at]) {
+        ans = std::to_string(at) + (ans.empty() ? "" : "->" + ans);
+    }
+
+    return ans;
+}
+
+    /**
+     * @brief Finds a negative cycle in the graph using Bellman-Ford algorithm.
+     * 
+     * @param graph The Graph object representing the graph.
+     * @return std::string Returns a string representing the vertices in the negative cycle.
+     */
+    std::string negativeCycle(Graph graph) {
+        std::vector<std::vector<int>> cycles = negativeCycles(graph);
+        if (cycles.empty()) return "No Negative Cycle";
+
+        // Convert the first cycle to string format
+        std::string ans = "";
+        for (size_t i = 0; i < cycles[0].size(); i++) {
+            if (i > 0) ans = ans + "->";
+            ans = ans + std::to_string(cycles[0][i]);
+        }
+        return ans;
+    }
+
+    /**
+     * @brief Finds vertex-disjoint negative cycles anywhere in the graph.
+     *
+     * @param graph The Graph object representing the graph.
+     * @return std::vector<std::vector<int>> The cycles, each closed by repeating its first vertex.
+     */
+    std::vector<std::vector<int>> negativeCycles(const Graph& graph) {
+        std::vector<long long> dist;
+        return relaxFromSuperSource(adjacencyLists(graph.getMatrix()), dist);
+    }
+
+    /**
+     * @brief Finds a minimum spanning forest of the graph.
+     *
+     * @param graph The Graph object representing the graph.
+     * @param method The algorithm to use.
+     * @return SpanningForest The forest edges and their total weight.
+     */
+    SpanningForest minimumSpanningForest(const Graph& graph, MSTMethod method) {
+        const std::vector<std::vector<int>>& g = graph.getMatrix();
+        switch (method) {
+            case MSTMethod::Kruskal:
+                return kruskalForest(g);
+            case MSTMethod::Boruvka:
+                return boruvkaForest(g);
+            case MSTMethod::Prim:
+            default:
+                return primForest(g);
+        }
+    }
+
+    /**
+     * @brief Returns the distance from i to j (INF if unreachable).
+     */
+    long long DistanceTable::distance(int i, int j) const {
+        return this->dist[static_cast<size_t>(i) * this->n + j];
+    }
+
+    /**
+     * @brief Reconstructs a shortest path from i to j by following the next-hop matrix.
+     * @return The vertices of the path from i to j, or an empty vector if j is unreachable
+     *         or the next hops go round a cycle (possible through zero-weight cycles).
+     */
+    std::vector<int> DistanceTable::path(int i, int j) const {
+        if (this->negativeCycle || distance(i, j) == INF) return {};
+        std::vector<int> ans = {i};
+        int at = i;
+        while (at != j && static_cast<int>(ans.size()) <= this->n) {
+            at = this->next[static_cast<size_t>(at) * this->n + j];
+            if (at == -1) return {};
+            ans.push_back(at);
+        }
+        if (at != j) return {};
+        return ans;
+    }
+
+    /**
+     * @brief Computes the shortest distance between every ordered pair of vertices.
+     *
+     * @param graph The Graph object representing the graph.
+     * @param method The algorithm to use.
+     * @return DistanceTable The distance and next-hop matrices.
+     */
+    DistanceTable allPairsShortestPaths(const Graph& graph, APSPMethod method) {
+        const std::vector<std::vector<int>>& g = graph.getMatrix();
+        int n = g.size();
+        DistanceTable table;
+        table.n = n;
+        table.dist.assign(static_cast<size_t>(n) * n, DistanceTable::INF);
+        table.next.assign(static_cast<size_t>(n) * n, -1);
+
+        long long edges = 0;
+        bool negativeWeights = false;
+        for (int u = 0; u < n; ++u) {
+            edges += n - std::count(g[u].begin(), g[u].end(), 0);
+            negativeWeights = negativeWeights || *std::min_element(g[u].begin(), g[u].end()) < 0;
+        }
+        if (method == APSPMethod::Auto) {
+            method = edges * 16 < static_cast<long long>(n) * n ? APSPMethod::Johnson : APSPMethod::FloydWarshall;
+        }
+        if (method == APSPMethod::Johnson) {
+            johnson(g, table);
+            return table;
+        }
+
+        // distances around a negative cycle keep doubling down, so find one before relaxing
+        std::vector<long long> h;
+        if (negativeWeights && !relaxFromSuperSource(adjacencyLists(g), h).empty()) {
+            table.negativeCycle = true;
+            return table;
+        }
+        for (int u = 0; u < n; ++u) {
+            for (int v = 0; v < n; ++v) {
+                if (g[u][v] == 0 && u != v) continue;
+                size_t cell = static_cast<size_t>(u) * n + v;
+                table.dist[cell] = u == v ? std::min(0, g[u][v]) : g[u][v];
+                table.next[cell] = v;
+            }
+        }
+        blockedFloydWarshall(table);
+        for (size_t cell = 0; cell < table.dist.size(); ++cell) {
+            if (table.dist[cell] > DistanceTable::INF / 2) {
+                table.dist[cell] = DistanceTable::INF;
+                table.next[cell] = -1;
+            }
+        }
+        return table;
+    }
+
+    /**
+     * @brief Computes the transitive closure of the graph as a packed reachability matrix.
+     *
+     * Rows inside the current block of k are closed first, in plain Warshall order, so that
+     * they are read-only while the other rows are updated in parallel.
+     *
+     * @param graph The Graph object representing the graph.
+     * @return BitMatrix Entry (u, v) is set if there is a path of length at least 1 from u to v.
+     */
+    BitMatrix transitiveClosure(const Graph& graph) {
+        BitMatrix reach(graph);
+        int n = reach.getSize();
+        int words = reach.getWords();
+        auto closeRow = [&reach, words](int i, int kBegin, int kEnd) {
+            uint64_t* target = reach.row(i);
+            for (int k = kBegin; k < kEnd; ++k) {
+                if (!((target[k >> 6] >> (k & 63)) & 1)) continue;
+                const uint64_t* source = reach.row(k);
+                for (int x = 0; x < words; ++x) target[x] |= source[x];
+            }
+        };
+
+        for (int kBegin = 0; kBegin < n; kBegin += 64) {
+            int kEnd = std::min(kBegin + 64, n);
+            for (int k = kBegin; k < kEnd; ++k) {
+                for (int i = kBegin; i < kEnd; ++i) closeRow(i, k, k + 1);
+            }
+            Parallel::forRange(0, n, std::max(1, 8192 / std::max(words, 1)), [&](int lo, int hi) {
+                for (int i = lo; i < hi; ++i) {
+                    if (i < kBegin || i >= kEnd) closeRow(i, kBegin, kEnd);
+                }
+            });
+        }
+        return reach;
+    }
+
+    /**
+     * @brief Computes the PageRank of every vertex.
+     *
+     * @param graph The Graph object representing the graph.
+     * @param damping The probability of following a link rather than teleporting.
+     * @param tolerance Stops once the L1 change of the ranks in one iteration is below this.
+     * @param maxIterations Stops after this many iterations.
+     * @return std::vector<double> The rank of every vertex.
+     */
+    std::vector<double> pageRank(const Graph& graph, double damping, double tolerance, int maxIterations) {
+        return pageRank(SparseMatrix(graph), damping, tolerance, maxIterations);
+    }
+
+    /**
+     * @brief Computes the PageRank of every vertex of a sparse adjacency matrix.
+     *
+     * @param adjacency The adjacency matrix in CSR form.
+     * @param damping The probability of following a link rather than teleporting.
+     * @param tolerance Stops once the L1 change of the ranks in one iteration is below this.
+     * @param maxIterations Stops after this many iterations.
+     * @return std::vector<double> The rank of every vertex.
+     */
+    std::vector<double> pageRank(const SparseMatrix& adjacency, double damping, double tolerance, int maxIterations) {
+        int n = adjacency.getSize();
+        if (n == 0) return {};
+        SparseMatrix incoming = adjacency.transpose();
+        std::vector<int> outDegree(n);
+        for (int u = 0; u < n; ++u) outDegree[u] = static_cast<int>(adjacency.rowEnd(u) - adjacency.rowBegin(u));
+
+        std::vector<double> rank(n, 1.0 / n), next(n), share(n);
+        for (int iteration = 0; iteration < maxIterations; ++iteration) {
+            double dangling = 0;
+            for (int u = 0; u < n; ++u) {
+                if (outDegree[u] == 0) {
+                    dangling += rank[u];
+                    share[u] = 0;
+                } else {
+                    share[u] = rank[u] / outDegree[u];
+                }
+            }
+            double base = (1 - damping) / n + damping * dangling / n;
+
+            Parallel::forRange(0, n, 4096, [&](int lo, int hi) {
+                for (int v = lo; v < hi; ++v) {
+                    double sum = 0;
+                    for (long long e = incoming.rowBegin(v); e < incoming.rowEnd(v); ++e) sum += share[incoming.column(e)];
+                    next[v] = base + damping * sum;
+                }
+            });
+
+            double change = 0;
+            for (int v = 0; v < n; ++v) change += std::fabs(next[v] - rank[v]);
+            rank.swap(next);
+            if (change < tolerance) break;
+        }
+        return rank;
+    }
+
+    /**
+     * @brief Approximates the PageRank personalised to one seed vertex by local forward push.
+     *
+     * @param graph The Graph object representing the graph.
+     * @param seed The vertex the random walk restarts at.
+     * @param damping The probability of following a link rather than restarting.
+     * @param epsilon The residual threshold per unit of out-degree.
+     * @return The (vertex, score) pairs with a non-zero score, highest score first.
+     */
+    std::vector<std::pair<int, double>> personalizedPageRank(const Graph& graph, int seed, double damping, double epsilon) {
+        return personalizedPageRank(SparseMatrix(graph), seed, damping, epsilon);
+    }
+
+    /**
+     * @brief Approximates the personalised PageRank on a prebuilt sparse adjacency matrix.
+     *
+     * Estimates and residuals live in hash maps, so a query touches only the vertices the
+     * push reaches. Residual left on a dangling vertex restarts at the seed.
+     */
+    std::vector<std::pair<int, double>> personalizedPageRank(const SparseMatrix& adjacency, int seed,
+                                                             double damping, double epsilon) {
+        if (seed < 0 || seed >= adjacency.getSize()) {
+            throw std::invalid_argument("Seed vertex doesn't match Graph size.");
+        }
+
+        std::unordered_map<int, double> estimate, residual;
+        std::deque<int> active = {seed};
+        residual[seed] = 1.0;
+        auto threshold = [&](int u) {
+            long long degree = adjacency.rowEnd(u) - adjacency.rowBegin(u);
+            return epsilon * static_cast<double>(std::max(1LL, degree));
+        };
+
+        while (!active.empty()) {
+            int u = active.front();
+            active.pop_front();
+            double mass = residual[u];
+            if (mass <= threshold(u)) continue;
+            residual[u] = 0;
+            estimate[u] += (1 - damping) * mass;
+
+            long long degree = adjacency.rowEnd(u) - adjacency.rowBegin(u);
+            if (degree == 0) {
+                double before = residual[seed];
+                residual[seed] = before + damping * mass;
+                if (before <= threshold(seed) && residual[seed] > threshold(seed)) active.push_back(seed);
+                continue;
+            }
+            double share = damping * mass / degree;
+            for (long long e = adjacency.rowBegin(u); e < adjacency.rowEnd(u); ++e) {
+                int v = adjacency.column(e);
+                double before = residual[v];
+                residual[v] = before + share;
+                // queue v only when it crosses the threshold, so it is never queued twice
+                if (before <= threshold(v) && residual[v] > threshold(v)) active.push_back(v);
+            }
+        }
+
+        std::vector<std::pair<int, double>> ans(estimate.begin(), estimate.end());
+        std::sort(ans.begin(), ans.end(), [](const std::pair<int, double>& a, const std::pair<int, double>& b) {
+            return a.second != b.second ? a.second > b.second : a.first < b.first;
+        });
+        return ans;
+    }
+
+    /**
+     * @brief Computes the betweenness centrality of every vertex with Brandes' algorithm.
+     *
+     * @param graph The Graph object representing the graph.
+     * @param method Whether paths are counted in edges or in total weight.
+     * @param samples The number of sampled sources, or 0 for the exact scores.
+     * @param seed The seed of the source sampling.
+     * @return std::vector<double> The betweenness of every vertex.
+     */
+    std::vector<double> betweenness(const Graph& graph, BetweennessMethod method, int samples, unsigned int seed) {
+        const std::vector<std::vector<int>>& g = graph.getMatrix();
+        int n = g.size();
+        if (samples < 0) {
+            throw std::invalid_argument("The number of samples must not be negative.");
+        }
+        bool weighted = method == BetweennessMethod::Weighted;
+        std::vector<std::vector<std::pair<int, int>>> adj = adjacencyLists(g);
+        if (weighted) {
+            for (int u = 0; u < n; ++u) {
+                for (const std::pair<int, int>& edge : adj[u]) {
+                    if (edge.second < 0) {
+                        throw std::invalid_argument("Weighted betweenness requires positive edge weights.");
+                    }
+                }
+            }
+        }
+
+        std::vector<int> sources(n);
+        std::iota(sources.begin(), sources.end(), 0);
+        double scale = 1;
+        if (samples > 0 && samples < n) {
+            // partial Fisher-Yates: the first samples entries become a uniform random subset
+            std::mt19937 random(seed);
+            for (int i = 0; i < samples; ++i) {
+                std::uniform_int_distribution<int> pick(i, n - 1);
+                std::swap(sources[i], sources[pick(random)]);
+            }
+            sources.resize(samples);
+            scale = static_cast<double>(n) / samples;
+        }
+
+        int workers = Parallel::threadCount();
+        std::vector<std::vector<double>> partial(workers, std::vector<double>(n, 0));
+        int used = Parallel::forWorkers(0, sources.size(), 1, [&](int worker, int lo, int hi) {
+            BrandesWorkspace work(n);
+            for (int i = lo; i < hi; ++i) work.accumulate(adj, sources[i], weighted, partial[worker]);
+        });
+
+        std::vector<double> score(n, 0);
+        for (int worker = 0; worker < used; ++worker) {
+            for (int v = 0; v < n; ++v) score[v] += partial[worker][v];
+        }
+        for (double& value : score) value *= scale;
+        return score;
+    }
+
+    /**
+     * @brief Number of sampled sources that makes sampled betweenness accurate.
+     *
+     * Each sampled source s contributes dependency(s, v) / (n - 2), a value in [0, 1], so
+     * Hoeffding gives 2 exp(-2 k epsilon^2) per vertex; the union bound multiplies by n.
+     *
+     * @param n The number of vertices.
+     * @param epsilon The error as a fraction of n * (n - 2).
+     * @param delta The allowed failure probability.
+     * @return int The number of samples, at most n.
+     */
+    int betweennessSampleSize(int n, double epsilon, double delta) {
+        if (!(epsilon > 0 && epsilon < 1) || !(delta > 0 && delta < 1)) {
+            throw std::invalid_argument("Epsilon and delta must be between 0 and 1.");
+        }
+        if (n <= 0) return 0;
+        double k = std::ceil(std::log(2.0 * n / delta) / (2 * epsilon * epsilon));
+        return k >= n ? n : static_cast<int>(k);
+    }
+
+    /**
+     * @brief Counts the triangles of the graph, treated as undirected.
+     *
+     * The bit rows pay off once the average out-list is longer than about n / 128 words,
+     * i.e. when n^2 < 128 E; below that the sorted merge touches less memory.
+     *
+     * @param graph The Graph object representing the graph.
+     * @return long long The number of triangles.
+     */
+    long long triangleCount(const Graph& graph) {
+        OrientedGraph oriented = orientByDegree(graph.getMatrix());
+        const std::vector<long long>& start = oriented.start;
+        const std::vector<int>& target = oriented.target;
+        int n = oriented.vertexOf.size();
+        bool dense = static_cast<double>(n) * n < 128.0 * static_cast<double>(target.size());
+
+        BitMatrix out(dense ? n : 0);
+        if (dense) {
+            for (int r = 0; r < n; ++r) {
+                for (long long e = start[r]; e < start[r + 1]; ++e) out.set(r, target[e], true);
+            }
+        }
+
+        std::vector<long long> partial(Parallel::threadCount(), 0);
+        int used = Parallel::forWorkers(0, n, 64, [&](int worker, int lo, int hi) {
+            long long count = 0;
+            for (int r = lo; r < hi; ++r) {
+                for (long long e = start[r]; e < start[r + 1]; ++e) {
+                    int s = target[e];
+                    if (dense) {
+                        // both rows only hold ranks above s, so skip the words before it
+                        const uint64_t* a = out.row(r);
+                        const uint64_t* b = out.row(s);
+                        for (int x = s >> 6; x < out.getWords(); ++x) count += __builtin_popcountll(a[x] & b[x]);
+                    } else {
+                        long long i = e + 1, j = start[s];
+                        while (i < start[r + 1] && j < start[s + 1]) {
+                            int a = target[i], b = target[j];
+                            count += a == b;
+                            i += a <= b;
+                            j += b <= a;
+                        }
+                    }
+                }
+            }
+            partial[worker] = count;
+        });
+        return std::accumulate(partial.begin(), partial.begin() + used, 0LL);
+    }
+
+    /**
+     * @brief Counts the triangles of the graph, in total, per vertex and per edge.
+     *
+     * @param graph The Graph object representing the graph.
+     * @return TriangleCounts The total, per-vertex and per-edge counts.
+     */
+    TriangleCounts triangles(const Graph& graph) {
+        OrientedGraph oriented = orientByDegree(graph.getMatrix());
+        const std::vector<long long>& start = oriented.start;
+        const std::vector<int>& target = oriented.target;
+        int n = oriented.vertexOf.size();
+        long long m = target.size();
+
+        int workers = Parallel::threadCount();
+        std::vector<std::vector<long long>> vertexPartial(workers), edgePartial(workers);
+        int used = Parallel::forWorkers(0, n, 64, [&](int worker, int lo, int hi) {
+            std::vector<long long>& vertex = vertexPartial[worker];
+            std::vector<long long>& edge = edgePartial[worker];
+            vertex.assign(n, 0);
+            edge.assign(m, 0);
+            for (int r = lo; r < hi; ++r) {
+                for (long long e = start[r]; e < start[r + 1]; ++e) {
+                    int s = target[e];
+                    long long i = e + 1, j = start[s];
+                    while (i < start[r + 1] && j < start[s + 1]) {
+                        int a = target[i], b = target[j];
+                        if (a == b) {
+                            ++edge[e];
+                            ++edge[i];
+                            ++edge[j];
+                            ++vertex[r];
+                            ++vertex[s];
+                            ++vertex[a];
+                        }
+                        i += a <= b;
+                        j += b <= a;
+                    }
+                }
+            }
+        });
+
+        TriangleCounts counts;
+        counts.perVertex.assign(n, 0);
+        std::vector<long long> perOriented(m, 0);
+        for (int worker = 0; worker < used; ++worker) {
+            for (int r = 0; r < n; ++r) counts.perVertex[oriented.vertexOf[r]] += vertexPartial[worker][r];
+            for (long long e = 0; e < m; ++e) perOriented[e] += edgePartial[worker][e];
+        }
+
+        std::vector<std::pair<std::pair<int, int>, long long>> edges;
+        edges.reserve(m);
+        for (int r = 0; r < n; ++r) {
+            for (long long e = start[r]; e < start[r + 1]; ++e) {
+                int u = oriented.vertexOf[r], v = oriented.vertexOf[target[e]];
+                edges.push_back({{std::min(u, v), std::max(u, v)}, perOriented[e]});
+                counts.total += perOriented[e];
+            }
+        }
+        counts.total /= 3;
+        std::sort(edges.begin(), edges.end());
+        counts.edges.reserve(m);
+        counts.perEdge.reserve(m);
+        for (const std::pair<std::pair<int, int>, long long>& edge : edges) {
+            counts.edges.push_back(edge.first);
+            counts.perEdge.push_back(edge.second);
+        }
+        return counts;
+    }
+
+    /**
+     * @brief Computes the local clustering coefficient of every vertex.
+     *
+     * @param graph The Graph object representing the graph.
+     * @return std::vector<double> The clustering coefficient of every vertex.
+     */
+    std::vector<double> clusteringCoefficients(const Graph& graph) {
+        const std::vector<std::vector<int>>& g = graph.getMatrix();
+        int n = g.size();
+        std::vector<long long> perVertex = triangles(graph).perVertex;
+        std::vector<double> coefficient(n, 0);
+        for (int u = 0; u < n; ++u) {
+            long long degree = 0;
+            for (int v = 0; v < n; ++v) {
+                if (v != u && (g[u][v] != 0 || g[v][u] != 0)) ++degree;
+            }
+            if (degree >= 2) coefficient[u] = 2.0 * perVertex[u] / (degree * (degree - 1));
+        }
+        return coefficient;
+    }
+
+    /**
+     * @brief Computes the core number of every vertex and a degeneracy ordering.
+     *
+     * @param graph The Graph object representing the graph.
+     * @param method The algorithm to use.
+     * @return CoreDecomposition The core numbers, the ordering and the degeneracy.
+     */
+    CoreDecomposition coreNumbers(const Graph& graph, CoreMethod method) {
+        std::vector<std::vector<int>> adj = undirectedNeighbours(graph.getMatrix());
+        CoreDecomposition result;
+        if (method == CoreMethod::LevelSynchronous) {
+            peelCoresInRounds(adj, result);
+        } else {
+            peelCores(adj, result);
+        }
+        for (int core : result.core) result.degeneracy = std::max(result.degeneracy, core);
+        return result;
+    }
+
+    /**
+     * @brief Finds articulation points, bridges and biconnected components in O(V + E).
+     *
+     * @param graph The Graph object representing the graph.
+     * @return Biconnectivity The articulation points, bridges and components.
+     */
+    Biconnectivity biconnectedComponents(const Graph& graph) {
+        std::vector<std::vector<int>> adj = undirectedNeighbours(graph.getMatrix());
+        int n = adj.size();
+        std::vector<int> discovered(n, -1), low(n, 0), parent(n, -1), member(n, -1);
+        std::vector<size_t> nextEdge(n, 0);
+        std::vector<char> cut(n, 0);
+        std::vector<int> path;
+        std::vector<std::pair<int, int>> edges;
+        Biconnectivity result;
+        int time = 0;
+
+        for (int root = 0; root < n; ++root) {
+            if (discovered[root] != -1) continue;
+            discovered[root] = low[root] = time++;
+            path.push_back(root);
+            int rootChildren = 0;
+
+            while (!path.empty()) {
+                int v = path.back();
+                if (nextEdge[v] < adj[v].size()) {
+                    int w = adj[v][nextEdge[v]++];
+                    if (discovered[w] == -1) {
+                        parent[w] = v;
+                        discovered[w] = low[w] = time++;
+                        edges.push_back({v, w});
+                        path.push_back(w);
+                        if (v == root) ++rootChildren;
+                    } else if (w != parent[v] && discovered[w] < discovered[v]) {
+                        // back edge to an ancestor
+                        low[v] = std::min(low[v], discovered[w]);
+                        edges.push_back({v, w});
+                    }
+                    continue;
+                }
+
+                // v is finished: report to its parent what it learned
+                path.pop_back();
+                int p = parent[v];
+                if (p == -1) continue;
+                low[p] = std::min(low[p], low[v]);
+                if (low[v] > discovered[p]) result.bridges.push_back({std::min(p, v), std::max(p, v)});
+                if (low[v] >= discovered[p]) {
+                    if (p != root) cut[p] = 1;
+                    int id = result.components.size();
+                    std::vector<int> component;
+                    std::pair<int, int> edge;
+                    do {
+                        edge = edges.back();
+                        edges.pop_back();
+                        for (int x : {edge.first, edge.second}) {
+                            if (member[x] != id) {
+                                member[x] = id;
+                                component.push_back(x);
+                            }
+                        }
+                    } while (edge.first != p || edge.second != v);
+                    std::sort(component.begin(), component.end());
+                    result.components.push_back(component);
+                }
+            }
+            if (rootChildren >= 2) cut[root] = 1;
+        }
+
+        for (int v = 0; v < n; ++v) {
+            if (cut[v]) result.articulationPoints.push_back(v);
+        }
+        std::sort(result.bridges.begin(), result.bridges.end());
+        std::sort(result.components.begin(), result.components.end());
+        return result;
+    }
+
+    /**
+     * @brief Orders the vertices so every edge goes forward, or finds a directed cycle.
+     *
+     * @param graph The Graph object representing the graph.
+     * @return TopologicalOrder The order, or the cycle.
+     */
+    TopologicalOrder topologicalOrder(const Graph& graph) {
+        const std::vector<std::vector<int>>& g = graph.getMatrix();
+        int n = g.size();
+        TopologicalOrder result;
+        result.order = kahnOrder(adjacencyLists(g));
+        if (static_cast<int>(result.order.size()) == n) return result;
+
+        result.acyclic = false;
+        std::vector<char> removed(n, 0);
+        for (int v : result.order) removed[v] = 1;
+        result.order.clear();
+
+        // every remaining vertex has a remaining in-neighbour; walk back until one repeats
+        std::vector<int> seenAt(n, -1);
+        std::vector<int> walk;
+        int v = 0;
+        while (removed[v]) ++v;
+        while (seenAt[v] == -1) {
+            seenAt[v] = walk.size();
+            walk.push_back(v);
+            int u = 0;
+            while (removed[u] || g[u][v] == 0) ++u;
+            v = u;
+        }
+        result.cycle.assign(walk.rbegin(), walk.rend() - seenAt[v]);
+        result.cycle.push_back(result.cycle[0]);
+        return result;
+    }
+
+    /**
+     * @brief Reconstructs the best path from the source to v.
+     * @return The vertices of the path, or an empty vector if v is unreachable.
+     */
+    std::vector<int> DagPaths::path(int v) const {
+        std::vector<int> ans;
+        if (this->dist[v] == DistanceTable::INF) return ans;
+        for (int at = v; at != -1; at = this->parent[at]) ans.push_back(at);
+        std::reverse(ans.begin(), ans.end());
+        return ans;
+    }
+
+    /**
+     * @brief Computes shortest or longest paths from a source in a DAG in O(V + E).
+     *
      * @param graph The Graph object representing the graph.
-     * @return int Returns 1 if the graph is connected, 0 otherwise.
+     * @param source The source vertex.
+     * @param objective Whether to minimise or maximise the total weight.
+     * @return DagPaths The path weights and parents.
      */
-    int isConnected(Graph graph) {
-        const std::vector<std::vector<int>> g = graph.getMatrix();
+    DagPaths dagPaths(const Graph& graph, int source, PathObjective objective) {
+        const std::vector<std::vector<int>>& g = graph.getMatrix();
         int n = g.size();
-        if (n == 0) return 1;
-        std::vector<bool> visited(n, false);
-        std::stack<int> stk;
-        // Start DFS from vertex 0
-        stk.push(0);
-        visited[0] = true;
-        int counter = 1;
-        while (!stk.empty()) {
-            int current = stk.top();
-            stk.pop();
-            for (int i = 0; i < n; i++) {
-                if (g[current][i] != 0 && !visited[i]) {
-                    visited[i] = true;
-                    stk.push(i);
-                    counter++;
+        if (source < 0 || source >= n) {
+            throw std::invalid_argument("Source vertex doesn't match Graph size.");
+        }
+        std::vector<std::vector<std::pair<int, int>>> adj = adjacencyLists(g);
+        std::vector<int> order = requireTopologicalOrder(adj);
+
+        DagPaths result;
+        result.source = source;
+        result.dist.assign(n, DistanceTable::INF);
+        result.parent.assign(n, -1);
+        result.dist[source] = 0;
+        bool longest = objective == PathObjective::Longest;
+        for (int u : order) {
+            if (result.dist[u] == DistanceTable::INF) continue;
+            for (const std::pair<int, int>& edge : adj[u]) {
+                int v = edge.first;
+                long long candidate = result.dist[u] + edge.second;
+                bool better = result.dist[v] == DistanceTable::INF ||
+                              (longest ? candidate > result.dist[v] : candidate < result.dist[v]);
+                if (better) {
+                    result.dist[v] = candidate;
+                    result.parent[v] = u;
                 }
             }
         }
-        if (counter == n) return 1;
-        return 0;
+        return result;
     }
 
     /**
-     * @brief Checks if the given graph contains a cycle.
-     * 
+     * @brief Finds the path of maximum total weight in a DAG, starting anywhere.
+     *
+     * Every vertex starts at weight 0, as if a zero-weight edge led to it from a virtual
+     * source, and edges are relaxed in topological order.
+     *
      * @param graph The Graph object representing the graph.
-     * @return bool Returns true if the graph contains a cycle, false otherwise.
+     * @return CriticalPath The weight and the vertices of the path.
      */
-    bool isContainsCycle(Graph graph) {
-        const std::vector<std::vector<int>> g = graph.getMatrix();
+    CriticalPath criticalPath(const Graph& graph) {
+        const std::vector<std::vector<int>>& g = graph.getMatrix();
         int n = g.size();
-        if (n <= 1) return false;
-        std::vector<bool> visited(n, false);
-        std::stack<std::pair<int, int>> stk;
+        std::vector<std::vector<std::pair<int, int>>> adj = adjacencyLists(g);
+        std::vector<int> order = requireTopologicalOrder(adj);
 
-        for (int startVer = 0; startVer < n; startVer++) {
-            if (visited[startVer]) continue;
-            stk.push({startVer, -1});
+        CriticalPath result;
+        if (n == 0) return result;
+        std::vector<long long> finish(n, 0);
+        std::vector<int> parent(n, -1);
+        for (int u : order) {
+            for (const std::pair<int, int>& edge : adj[u]) {
+                int v = edge.first;
+                if (finish[u] + edge.second > finish[v]) {
+                    finish[v] = finish[u] + edge.second;
+                    parent[v] = u;
+                }
+            }
+        }
+        int last = std::max_element(finish.begin(), finish.end()) - finish.begin();
+        result.length = finish[last];
+        for (int at = last; at != -1; at = parent[at]) result.path.push_back(at);
+        std::reverse(result.path.begin(), result.path.end());
+        return result;
+    }
 
-            while (!stk.empty()) {
-                int current = stk.top().first;
-                int parent = stk.top().second;
-                stk.pop();
-                if (visited[current]) continue;
-                visited[current] = true;
-                for (int i = 0; i < n; i++) {
-                    if (g[current][i] != 0) {
-                        if (visited[i] && i != parent) {
-                            return true; // Found a cycle
-                        }
-                        if (!visited[i]) {
-                            stk.push({i, current}); // Push the node and its parent
+    /**
+     * @brief Computes a maximum flow from source to sink with push-relabel.
+     *
+     * The discharge loop continues until no vertex other than the source and the sink
+     * has excess, so excess that cannot reach the sink is returned to the source and the
+     * result is a flow, not only a preflow.
+     *
+     * @param graph The Graph object representing the graph.
+     * @param source The source vertex.
+     * @param sink The sink vertex.
+     * @param withFlow Whether to fill FlowResult::flow.
+     * @return FlowResult The flow value, the source side of a minimum cut and, if asked, the flow.
+     */
+    FlowResult maxFlow(const Graph& graph, int source, int sink, bool withFlow) {
+        const std::vector<std::vector<int>>& g = graph.getMatrix();
+        int n = g.size();
+        if (source < 0 || source >= n || sink < 0 || sink >= n) {
+            throw std::invalid_argument("Source or sink vertex doesn't match Graph size.");
+        }
+        if (source == sink) {
+            throw std::invalid_argument("Source and sink must be different vertices.");
+        }
+        for (int u = 0; u < n; ++u) {
+            for (int v = 0; v < n; ++v) {
+                if (g[u][v] < 0) throw std::invalid_argument("Capacities must not be negative.");
+            }
+        }
+
+        PushRelabel solver(g, source, sink);
+        FlowResult result;
+        result.value = solver.run();
+
+        std::vector<char> reached(n, 0);
+        std::vector<int> queue = {source};
+        reached[source] = 1;
+        for (size_t i = 0; i < queue.size(); ++i) {
+            int u = queue[i];
+            for (long long a = solver.start[u]; a < solver.start[u + 1]; ++a) {
+                int v = solver.head[a];
+                if (!reached[v] && solver.residual[a] > 0) {
+                    reached[v] = 1;
+                    queue.push_back(v);
+                }
+            }
+        }
+        for (int v = 0; v < n; ++v) {
+            if (reached[v]) result.sourceSide.push_back(v);
+        }
+
+        if (withFlow) {
+            result.flow.resize(n);
+            for (int u = 0; u < n; ++u) {
+                result.flow[u].assign(n, 0);
+                for (long long a = solver.start[u]; a < solver.start[u + 1]; ++a) {
+                    int v = solver.head[a];
+                    // net flow u->v is the capacity of u->v minus what is left of it
+                    long long net = g[u][v] - static_cast<long long>(solver.residual[a]);
+                    if (net > 0) result.flow[u][v] = static_cast<int>(net);
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Finds a maximum matching of a bipartite graph with Hopcroft-Karp.
+     *
+     * @param graph The Graph object representing the graph.
+     * @return Matching The matched pairs and the partner of every vertex.
+     */
+    Matching maxBipartiteMatching(const Graph& graph) {
+        const std::vector<std::vector<int>>& g = graph.getMatrix();
+        int n = g.size();
+        std::vector<int> side;
+        if (!twoColoring(g, side)) {
+            throw std::invalid_argument("The graph is not bipartite.");
+        }
+
+        std::vector<int> left;
+        for (int u = 0; u < n; ++u) {
+            if (side[u] == 1) left.push_back(u);
+        }
+        std::vector<std::vector<int>> adj(n);
+        for (int u : left) {
+            for (int v = 0; v < n; ++v) {
+                if (v != u && (g[u][v] != 0 || g[v][u] != 0)) adj[u].push_back(v);
+            }
+        }
+
+        const int FAR = std::numeric_limits<int>::max();
+        Matching result;
+        result.mate.assign(n, -1);
+        std::vector<int>& mate = result.mate;
+        std::vector<int> layer(n), queue, path;
+        std::vector<size_t> nextEdge(n);
+        queue.reserve(n);
+        while (true) {
+            // BFS layers over side A: free vertices first, then the mates of their neighbours
+            queue.clear();
+            for (int u : left) {
+                layer[u] = mate[u] == -1 ? 0 : FAR;
+                if (mate[u] == -1) queue.push_back(u);
+            }
+            // limit: the first layer with an edge to a free vertex, where every shortest path ends
+            int limit = FAR;
+            for (size_t head = 0; head < queue.size(); ++head) {
+                int u = queue[head];
+                if (layer[u] >= limit) break;
+                for (int v : adj[u]) {
+                    int w = mate[v];
+                    if (w == -1) {
+                        limit = layer[u];
+                    } else if (layer[w] == FAR && layer[u] < limit) {
+                        layer[w] = layer[u] + 1;
+                        queue.push_back(w);
+                    }
+                }
+            }
+            if (limit == FAR) break;
+
+            for (int u : left) nextEdge[u] = 0;
+            for (int root : left) {
+                if (mate[root] != -1) continue;
+                path.assign(1, root);
+                while (!path.empty()) {
+                    int u = path.back();
+                    if (nextEdge[u] == adj[u].size()) {
+                        layer[u] = FAR; // dead end for the rest of this phase
+                        path.pop_back();
+                        continue;
+                    }
+                    int v = adj[u][nextEdge[u]++];
+                    int w = mate[v];
+                    if (w == -1 && layer[u] == limit) {
+                        // augment: every vertex on the path takes the neighbour it went through
+                        for (int x : path) {
+                            int y = adj[x][nextEdge[x] - 1];
+                            mate[x] = y;
+                            mate[y] = x;
                         }
+                        break;
                     }
+                    if (w != -1 && layer[u] < limit && layer[w] == layer[u] + 1) path.push_back(w);
                 }
             }
         }
-        return false;
+
+        for (int u : left) {
+            if (mate[u] != -1) result.pairs.push_back({u, mate[u]});
+        }
+        return result;
     }
 
     /**
-     * @brief Checks if the given graph is bipartite and returns the partitioning.
-     * 
+     * @brief Solves the assignment problem with the Hungarian algorithm in O(n^3).
+     *
+     * Column 0 of the work arrays is a virtual column holding the row being added.
+     *
+     * @param graph The cost matrix.
+     * @return Assignment The minimum total cost and the column of each row.
+     */
+    Assignment minimumCostAssignment(const Graph& graph) {
+        const std::vector<std::vector<int>>& g = graph.getMatrix();
+        int n = g.size();
+        const long long FAR = std::numeric_limits<long long>::max();
+        std::vector<long long> rowPotential(n + 1, 0), columnPotential(n + 1, 0), slack(n + 1);
+        std::vector<int> rowOf(n + 1, 0), previous(n + 1, 0);
+        std::vector<char> used(n + 1);
+
+        for (int i = 1; i <= n; ++i) {
+            rowOf[0] = i;
+            int column = 0;
+            std::fill(slack.begin(), slack.end(), FAR);
+            std::fill(used.begin(), used.end(), 0);
+            do {
+                used[column] = 1;
+                int row = rowOf[column];
+                long long delta = FAR;
+                int nextColumn = 0;
+                for (int j = 1; j <= n; ++j) {
+                    if (used[j]) continue;
+                    long long reduced = g[row - 1][j - 1] - rowPotential[row] - columnPotential[j];
+                    if (reduced < slack[j]) {
+                        slack[j] = reduced;
+                        previous[j] = column;
+                    }
+                    if (slack[j] < delta) {
+                        delta = slack[j];
+                        nextColumn = j;
+                    }
+                }
+                for (int j = 0; j <= n; ++j) {
+                    if (used[j]) {
+                        rowPotential[rowOf[j]] += delta;
+                        columnPotential[j] -= delta;
+                    } else {
+                        slack[j] -= delta;
+                    }
+                }
+                column = nextColumn;
+            } while (rowOf[column] != 0);
+            // flip the alternating path back to the virtual column
+            do {
+                int before = previous[column];
+                rowOf[column] = rowOf[before];
+                column = before;
+            } while (column != 0);
+        }
+
+        Assignment result;
+        result.column.assign(n, -1);
+        for (int j = 1; j <= n; ++j) {
+            result.column[rowOf[j] - 1] = j - 1;
+            result.cost += g[rowOf[j] - 1][j - 1];
+        }
+        return result;
+    }
+
+    /**
+     * @brief Colors the vertices so adjacent vertices differ, giving each the smallest free color.
+     *
+     * A vertex of degree d always finds a free color among 0..d, so a per-thread array of
+     * stamps, one per color, finds it in O(d) without clearing.
+     *
      * @param graph The Graph object representing the graph.
-     * @return std::string Returns a string indicating if the graph is bipartite and its partitioning.
+     * @param method The vertex order, or the parallel speculative mode.
+     * @return Coloring The color of every vertex and the number of colors.
      */
-    std::string isBipartite(Graph graphObj){
-        const std::vector<std::vector<int>> g = graphObj.getMatrix();
-        int n=g.size();
-        if(n==0)return "The graph is bipartite: A={}, B={}";
-        if(n==1)return "The graph is bipartite: A={0}, B={}";
-        if(n==2)return "The graph is bipartite: A={0}, B={1}";
-        std::vector<int> side(n,0);std::queue<int> q;
-        for(int startVertix=0;startVertix<n;startVertix++){//for each vertix make sure the while got it (if not connected)
-            if(side[startVertix]==0){
-                q.push(startVertix);side[startVertix]=1;
-                while (!q.empty()) {//check for each connected vertix if not bipartite
-                    int current = q.front();
-                    q.pop();
-                    for(int i=0;i<n;i++){
-                        if (g[current][i]!=0 && i>current){
-                            if(side[i]==side[current])return "0";
-                            if(side[i]==0)q.push(i);
-                            side[i]=side[current]*(-1);
+    Coloring greedyColoring(const Graph& graph, ColoringMethod method) {
+        std::vector<std::vector<int>> adj = undirectedNeighbours(graph.getMatrix());
+        int n = adj.size();
+        Coloring result;
+        result.color.assign(n, -1);
+
+        if (method == ColoringMethod::Speculative) {
+            std::vector<std::atomic<int>> color(n);
+            for (std::atomic<int>& c : color) c.store(-1, std::memory_order_relaxed);
+            std::vector<int> pending(n);
+            std::iota(pending.begin(), pending.end(), 0);
+            int workers = Parallel::threadCount();
+            std::vector<std::vector<int>> conflicts(workers);
+            while (!pending.empty()) {
+                Parallel::forRange(0, pending.size(), 1024, [&](int lo, int hi) {
+                    std::vector<int> stamp(n + 1, -1);
+                    for (int i = lo; i < hi; ++i) {
+                        int v = pending[i];
+                        for (int u : adj[v]) {
+                            int c = color[u].load(std::memory_order_relaxed);
+                            if (c >= 0 && c <= n) stamp[c] = v;
+                        }
+                        int c = 0;
+                        while (stamp[c] == v) ++c;
+                        color[v].store(c, std::memory_order_relaxed);
+                    }
+                });
+                int used = Parallel::forWorkers(0, pending.size(), 1024, [&](int worker, int lo, int hi) {
+                    conflicts[worker].clear();
+                    for (int i = lo; i < hi; ++i) {
+                        int v = pending[i];
+                        int c = color[v].load(std::memory_order_relaxed);
+                        for (int u : adj[v]) {
+                            if (u < v && color[u].load(std::memory_order_relaxed) == c) {
+                                conflicts[worker].push_back(v);
+                                break;
+                            }
                         }
                     }
+                });
+                pending.clear();
+                for (int worker = 0; worker < used; ++worker) {
+                    pending.insert(pending.end(), conflicts[worker].begin(), conflicts[worker].end());
+                }
+            }
+            for (int v = 0; v < n; ++v) result.color[v] = color[v].load(std::memory_order_relaxed);
+        } else {
+            std::vector<int> order(n);
+            std::iota(order.begin(), order.end(), 0);
+            if (method == ColoringMethod::LargestFirst) {
+                std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return adj[a].size() > adj[b].size(); });
+            } else if (method == ColoringMethod::SmallestLast) {
+                CoreDecomposition cores;
+                peelCores(adj, cores);
+                order.assign(cores.order.rbegin(), cores.order.rend());
+            }
+            std::vector<int> stamp(n + 1, -1);
+            for (int v : order) {
+                for (int u : adj[v]) {
+                    if (result.color[u] >= 0) stamp[result.color[u]] = v;
                 }
+                int c = 0;
+                while (stamp[c] == v) ++c;
+                result.color[v] = c;
             }
         }
-        std::string sideA = "";
-        std::string sideB = "";
-        for(int i=0;i<n;i++){
-            std::string next = std::to_string(i);
-            if(side[i]==1){
-                if(!sideA.empty())sideA+=", ";
-                sideA+=next;
+
+        for (int c : result.color) result.colors = std::max(result.colors, c + 1);
+        return result;
+    }
+
+    /**
+     * @brief Finds a minimum weight cut of the graph, treated as undirected.
+     *
+     * @param graph The Graph object representing the graph.
+     * @param method The algorithm to use.
+     * @param trials Karger-Stein trials; 0 picks ceil(log2 n)^2.
+     * @param seed The seed of the Karger-Stein random choices.
+     * @return GlobalCut The cut value and the two sides.
+     */
+    GlobalCut globalMinCut(const Graph& graph, MinCutMethod method, int trials, unsigned int seed) {
+        const std::vector<std::vector<int>>& g = graph.getMatrix();
+        int n = g.size();
+        if (n < 2) {
+            throw std::invalid_argument("A cut requires at least 2 vertices.");
+        }
+        ContractedGraph start;
+        start.weight.assign(n, std::vector<long long>(n, 0));
+        start.members.resize(n);
+        for (int u = 0; u < n; ++u) {
+            start.members[u] = {u};
+            for (int v = u + 1; v < n; ++v) {
+                int w = undirectedWeight(g, u, v);
+                if (w < 0) throw std::invalid_argument("Cut weights must not be negative.");
+                start.weight[u][v] = start.weight[v][u] = w;
             }
-            else{
-                if(!sideB.empty())sideB+=", ";
-                sideB+=next;
+        }
+
+        std::pair<long long, std::vector<int>> best;
+        if (method == MinCutMethod::StoerWagner) {
+            best = stoerWagner(start);
+        } else {
+            if (trials <= 0) {
+                int levels = static_cast<int>(std::ceil(std::log2(static_cast<double>(n))));
+                trials = std::max(1, levels * levels);
+            }
+            int workers = Parallel::threadCount();
+            std::vector<std::pair<long long, std::vector<int>>> found(
+                workers, std::make_pair(std::numeric_limits<long long>::max(), std::vector<int>()));
+            int used = Parallel::forWorkers(0, trials, 1, [&](int worker, int lo, int hi) {
+                for (int trial = lo; trial < hi; ++trial) {
+                    std::mt19937_64 random(seed + static_cast<unsigned long long>(trial) * 0x9E3779B97F4A7C15ULL);
+                    std::pair<long long, std::vector<int>> cut = kargerStein(start, random);
+                    if (cut.first < found[worker].first) found[worker] = cut;
+                }
+            });
+            best = found[0];
+            for (int worker = 1; worker < used; ++worker) {
+                if (found[worker].first < best.first) best = found[worker];
             }
         }
-        std::string ans = "The graph is bipartite: A={"+sideA+"}, B={"+sideB+"}";
-        return ans;
+
+        GlobalCut result;
+        result.value = best.first;
+        std::vector<char> inSide(n, 0);
+        for (int v : best.second) inSide[v] = 1;
+        for (int v = 0; v < n; ++v) (inSide[v] ? result.side : result.otherSide).push_back(v);
+        return result;
     }
 
     /**
-     * @brief Finds the shortest path between two vertices in the graph using Bellman-Ford.
-     * 
+     * @brief Lists every maximal clique of the graph, treated as undirected.
+     *
      * @param graph The Graph object representing the graph.
-     * @param start The starting vertex.
-     * @param end The ending vertex.
-     * @return std::string Returns a string representing the shortest path between the vertices.
+     * @param minimumSize Only cliques with at least this many vertices are returned.
+     * @return The cliques, each sorted, in increasing order.
      */
-    std::string shortestPath(Graph graph, int start, int end) {
-    const std::vector<std::vector<int>> g = graph.getMatrix();
-    int n = g.size();
-    if (start >= n || end >= n || start < 0 || end < 0) return "Input vertices don't match Graph size.";
-    if (end == start) return std::to_string(start);
+    std::vector<std::vector<int>> maximalCliques(const Graph& graph, int minimumSize) {
+        BitMatrix adjacency;
+        std::vector<std::vector<int>> neighbours;
+        std::vector<int> order, place;
+        cliqueSetup(graph.getMatrix(), adjacency, neighbours, order, place);
+        int n = order.size();
 
-    std::vector<int> VerDist(n, std::numeric_limits<int>::max());
-    std::vector<int> reconstruct(n, -1);
-    VerDist[start] = 0;
+        int workers = Parallel::threadCount();
+        std::vector<std::vector<std::vector<int>>> found(workers);
+        int used = Parallel::forWorkers(0, n, 1, [&](int worker, int lo, int hi) {
+            CliqueSearch search;
+            std::vector<uint64_t> candidates, excluded;
+            for (int i = lo; i < hi; ++i) {
+                int v = order[i];
+                if (static_cast<int>(neighbours[v].size()) + 1 < minimumSize) continue;
+                search.load(adjacency, neighbours[v], place, v, candidates, excluded);
+                search.enumerate(candidates, excluded, 0, [&](const std::vector<int>& local) {
+                    if (static_cast<int>(local.size()) + 1 < minimumSize) return;
+                    std::vector<int> clique = {v};
+                    for (int j : local) clique.push_back(search.vertex[j]);
+                    std::sort(clique.begin(), clique.end());
+                    found[worker].push_back(clique);
+                });
+            }
+        });
 
-    // Bellman-Ford algorithm
-    for (int i = 0; i < n - 1; ++i) {
-        for (int u = 0; u < n; ++u) {
-            for (int v = 0; v < n; ++v) {
-                if (g[u][v] != 0 && VerDist[u] != std::numeric_limits<int>::max() && VerDist[u] + g[u][v] < VerDist[v]) {
-                    VerDist[v] = VerDist[u] + g[u][v];
-                    reconstruct[v] = u;
+        std::vector<std::vector<int>> cliques;
+        for (int worker = 0; worker < used; ++worker) {
+            cliques.insert(cliques.end(), found[worker].begin(), found[worker].end());
+        }
+        std::sort(cliques.begin(), cliques.end());
+        return cliques;
+    }
+
+    /**
+     * @brief Finds a maximum clique of the graph, treated as undirected.
+     *
+     * @param graph The Graph object representing the graph.
+     * @return std::vector<int> The vertices of a maximum clique, sorted.
+     */
+    std::vector<int> maximumClique(const Graph& graph) {
+        BitMatrix adjacency;
+        std::vector<std::vector<int>> neighbours;
+        std::vector<int> order, place;
+        cliqueSetup(graph.getMatrix(), adjacency, neighbours, order, place);
+        int n = order.size();
+        if (n == 0) return {};
+
+        // any single vertex is a clique; searches only need to beat it
+        std::atomic<int> best(1);
+        int workers = Parallel::threadCount();
+        std::vector<std::vector<int>> found(workers);
+        int used = Parallel::forWorkers(0, n, 1, [&](int worker, int lo, int hi) {
+            CliqueSearch search;
+            std::vector<uint64_t> later, earlier;
+            for (int i = lo; i < hi; ++i) {
+                int v = order[i];
+                std::vector<int> forward;
+                for (int u : neighbours[v]) {
+                    if (place[u] > place[v]) forward.push_back(u);
+                }
+                if (static_cast<int>(forward.size()) + 1 <= best.load(std::memory_order_relaxed)) continue;
+                search.load(adjacency, forward, place, v, later, earlier);
+                std::vector<int> local;
+                search.maximum(later, 0, best, local);
+                if (local.size() + 1 > found[worker].size()) {
+                    found[worker] = local;
+                    found[worker].push_back(v);
                 }
             }
+        });
+
+        std::vector<int> clique = {order[0]};
+        for (int worker = 0; worker < used; ++worker) {
+            if (found[worker].size() > clique.size()) clique = found[worker];
         }
+        std::sort(clique.begin(), clique.end());
+        return clique;
     }
 
-    // Check for negative-weight cycles
-    for (int u = 0; u < n; ++u) {
-        for (int v = 0; v < n; ++v) {
-            if (g[u][v] != 0 && VerDist[u] != std::numeric_limits<int>::max() && VerDist[u] + g[u][v] < VerDist[v]) {
-                return "Graph contains a negative-weight cycle.";
+    /**
+     * @brief Computes the diameter: the largest distance between two vertices that are connected.
+     *
+     * @param graph The Graph object representing the graph.
+     * @param metric Whether distances count edges or weights.
+     * @return long long The diameter.
+     */
+    long long diameter(const Graph& graph, DistanceMetric metric) {
+        const std::vector<std::vector<int>>& g = graph.getMatrix();
+        int n = g.size();
+        DistanceSweep sweep(g, metric == DistanceMetric::Weights);
+        if (metric == DistanceMetric::Hops) {
+            std::vector<char> done(n, 0);
+            long long best = 0;
+            for (int v = 0; v < n; ++v) {
+                if (done[v]) continue;
+                best = std::max(best, componentDiameter(sweep, v));
+                for (int w : sweep.reached) done[w] = 1;
             }
+            return best;
         }
+
+        // bounds on every eccentricity; a vertex stays a candidate while its upper bound beats the best
+        const long long FAR = std::numeric_limits<long long>::max();
+        std::vector<long long> lower(n, 0), upper(n, FAR);
+        long long best = 0;
+        bool pickHigh = true;
+        while (true) {
+            int source = -1;
+            for (int v = 0; v < n; ++v) {
+                if (upper[v] <= best || lower[v] == upper[v]) continue;
+                if (source == -1 || (pickHigh ? upper[v] > upper[source] : lower[v] < lower[source])) source = v;
+            }
+            if (source == -1) break;
+            pickHigh = !pickHigh;
+            long long eccentricity = sweep.run(source);
+            best = std::max(best, eccentricity);
+            for (int w : sweep.reached) {
+                long long d = sweep.dist[w];
+                lower[w] = std::max(lower[w], std::max(d, eccentricity - d));
+                upper[w] = std::min(upper[w], eccentricity + d);
+            }
+            lower[source] = upper[source] = eccentricity;
+        }
+        for (int v = 0; v < n; ++v) {
+            if (lower[v] == upper[v]) best = std::max(best, lower[v]);
+        }
+        return best;
     }
 
-    if (VerDist[end] == std::numeric_limits<int>::max()) return "-1";
-    
-    // Reconstruct the path from endVer back to startVer
-    std::string ans;
-    for (int at = end; at != -1; at = reconstruct[at]) {
-        ans = std::to_string(at) + (ans.empty() ? "" : "->" + ans);
+    /**
+     * @brief Computes the eccentricity of every vertex: its largest distance to a vertex it can reach.
+     *
+     * @param graph The Graph object representing the graph.
+     * @param metric Whether distances count edges or weights.
+     * @return std::vector<long long> The eccentricity of every vertex.
+     */
+    std::vector<long long> eccentricities(const Graph& graph, DistanceMetric metric) {
+        const std::vector<std::vector<int>>& g = graph.getMatrix();
+        int n = g.size();
+        DistanceSweep sweep(g, metric == DistanceMetric::Weights);
+        const long long FAR = std::numeric_limits<long long>::max();
+        std::vector<long long> lower(n, 0), upper(n, FAR);
+        bool pickHigh = true;
+        while (true) {
+            int source = -1;
+            for (int v = 0; v < n; ++v) {
+                if (lower[v] == upper[v]) continue;
+                if (source == -1 || (pickHigh ? upper[v] > upper[source] : lower[v] < lower[source])) source = v;
+            }
+            if (source == -1) break;
+            pickHigh = !pickHigh;
+            long long eccentricity = sweep.run(source);
+            for (int w : sweep.reached) {
+                long long d = sweep.dist[w];
+                lower[w] = std::max(lower[w], std::max(d, eccentricity - d));
+                upper[w] = std::min(upper[w], eccentricity + d);
+            }
+            lower[source] = upper[source] = eccentricity;
+        }
+        return lower;
     }
 
-    return ans;
-}
+    /**
+     * @brief Computes closeness and harmonic centrality from hop distances.
+     *
+     * @param graph The Graph object representing the graph.
+     * @return Closeness Both scores of every vertex.
+     */
+    Closeness closeness(const Graph& graph) {
+        const std::vector<std::vector<int>>& g = graph.getMatrix();
+        int n = g.size();
+        std::vector<std::vector<int>> adj = outNeighbours(g);
+        std::vector<long long> total(n, 0), reached(n, 0);
+        std::vector<double> harmonic(n, 0);
+        multiSourceBfsAll(adj, [&](int source, int, long long level, int) {
+            total[source] += level;
+            reached[source] += 1;
+            harmonic[source] += 1.0 / level;
+        });
+
+        Closeness result;
+        result.harmonic = harmonic;
+        result.closeness.assign(n, 0);
+        for (int v = 0; v < n; ++v) {
+            if (total[v] == 0) continue;
+            result.closeness[v] = static_cast<double>(reached[v]) / total[v] * reached[v] / (n - 1);
+        }
+        return result;
+    }
 
     /**
-     * @brief Finds a negative cycle in the graph using Bellman-Ford algorithm.
-     * 
+     * @brief Computes the hop distance between every ordered pair of vertices.
+     *
      * @param graph The Graph object representing the graph.
-     * @return std::string Returns a string representing the vertices in the negative cycle.
+     * @return DistanceTable The hop distances and next-hop matrix.
      */
-    std::string negativeCycle(Graph graph) {
-        const std::vector<std::vector<int>> g = graph.getMatrix();
+    DistanceTable hopDistances(const Graph& graph) {
+        const std::vector<std::vector<int>>& g = graph.getMatrix();
         int n = g.size();
-        std::vector<int> dist(n, std::numeric_limits<int>::max());
-        std::vector<int> predecessor(n, -1);
+        std::vector<std::vector<int>> adj = outNeighbours(g);
+        DistanceTable table;
+        table.n = n;
+        table.dist.assign(static_cast<size_t>(n) * n, DistanceTable::INF);
+        table.next.assign(static_cast<size_t>(n) * n, -1);
+        for (int u = 0; u < n; ++u) {
+            table.dist[static_cast<size_t>(u) * n + u] = 0;
+            table.next[static_cast<size_t>(u) * n + u] = u;
+        }
+        // from is one level closer to the source, so its first hop is already known
+        multiSourceBfsAll(adj, [&](int source, int v, long long level, int from) {
+            size_t row = static_cast<size_t>(source) * n;
+            table.dist[row + v] = level;
+            table.next[row + v] = from == source ? v : table.next[row + from];
+        });
+        return table;
+    }
 
-        int cycleStart = -1;
-        dist[0] = 0;
+    /**
+     * @brief Finds the k cheapest loopless paths from start to end with Yen's algorithm.
+     *
+     * @param graph The Graph object representing the graph.
+     * @param start The start vertex.
+     * @param end The end vertex.
+     * @param k The number of paths wanted.
+     * @return std::vector<RankedPath> Up to k paths by increasing cost.
+     */
+    std::vector<RankedPath> kShortestPaths(const Graph& graph, int start, int end, int k) {
+        return kShortestPaths(SparseMatrix(graph), start, end, k);
+    }
 
-        // detect with Belman Ford if there is a cycle and one vertex on it
-        for (int step = 0; step < n; ++step) {
-            cycleStart = -1;
-            for (int u = 0; u < n; ++u) {
-                for (int v = 0; v < n; ++v) {
-                    if (g[u][v] && dist[u] != std::numeric_limits<int>::max() && dist[u] + g[u][v] < dist[v]) {
-                        dist[v] = dist[u] + g[u][v];
-                        predecessor[v] = u;
-                        if (step == n - 1) {
-                            cycleStart = v;
-                        }
-                    }
-                }
-            }
+    /**
+     * @brief Finds the k cheapest loopless paths on a prebuilt sparse adjacency matrix.
+     *
+     * Each accepted path keeps the cost of every prefix, so a root's cost is a lookup, and
+     * the index where it left the path it was spurred from: spurs before that index repeat
+     * searches already made for that path (Lawler), so they are skipped.
+     */
+    std::vector<RankedPath> kShortestPaths(const SparseMatrix& adjacency, int start, int end, int k) {
+        int n = adjacency.getSize();
+        if (start < 0 || start >= n || end < 0 || end >= n) {
+            throw std::invalid_argument("Input vertices don't match Graph size.");
         }
+        if (k < 0) throw std::invalid_argument("The number of paths must not be negative.");
+        for (long long e = 0; e < adjacency.nonZeros(); ++e) {
+            if (adjacency.value(e) < 0) throw std::invalid_argument("k shortest paths require positive edge weights.");
+        }
+        std::vector<RankedPath> found;
+        if (k == 0) return found;
 
-        if (cycleStart == -1) return "No Negative Cycle";
-        else {
-            // Finding the cycle
-            std::vector<int> cycle;
-            int v = cycleStart;
-            for (int i = 0; i < n; ++i) {
-                v = predecessor[v];
-            }
+        SpurSearch spur(adjacency, end);
+        // candidates by (cost, vertices), each with its prefix costs and deviation index; the map drops duplicates
+        typedef std::pair<std::vector<long long>, size_t> Deviation;
+        std::map<std::pair<long long, std::vector<int>>, Deviation> candidates;
+        Deviation last;
 
-            // Store the cycle in reverse order
-            int u = v;
-            cycle.push_back(v);
-            while (true) {
-                v = predecessor[v];
-                if (v == u) {
-                    break;
+        spur.reset();
+        std::vector<long long> firstPrefix, tailCosts;
+        std::vector<int> first = spur.search(start, firstPrefix);
+        if (first.empty()) return found;
+        candidates[{firstPrefix.back(), first}] = Deviation(firstPrefix, 0);
+
+        while (static_cast<int>(found.size()) < k && !candidates.empty()) {
+            RankedPath best;
+            best.cost = candidates.begin()->first.first;
+            best.vertices = candidates.begin()->first.second;
+            last = candidates.begin()->second;
+            candidates.erase(candidates.begin());
+            found.push_back(best);
+            if (static_cast<int>(found.size()) == k) break;
+
+            const std::vector<int>& path = found.back().vertices;
+            for (size_t i = last.second; i + 1 < path.size(); ++i) {
+                spur.reset();
+                for (size_t r = 0; r < i; ++r) spur.bannedAt[path[r]] = spur.epoch;
+                for (const RankedPath& other : found) {
+                    const std::vector<int>& vertices = other.vertices;
+                    if (vertices.size() > i + 1 && std::equal(path.begin(), path.begin() + i + 1, vertices.begin())) {
+                        spur.bannedNext.push_back(vertices[i + 1]);
+                    }
                 }
-                cycle.push_back(v);
-            }
-            cycle.push_back(u); // Complete the cycle by returning to the start vertex
+                std::vector<int> tail = spur.search(path[i], tailCosts);
+                if (tail.empty()) continue;
 
-            // Convert cycle to string format
-            std::string ans = "";
-            for (size_t i = 0; i < cycle.size(); i++) {
-                if (i > 0) ans = ans + "->";
-                std::string next = std::to_string(cycle[i]);
-                ans = ans + next;
+                std::vector<int> vertices(path.begin(), path.begin() + i);
+                std::vector<long long> prefix(last.first.begin(), last.first.begin() + i + 1);
+                long long rootCost = prefix.back();
+                for (size_t t = 1; t < tail.size(); ++t) prefix.push_back(rootCost + tailCosts[t]);
+                vertices.insert(vertices.end(), tail.begin(), tail.end());
+                candidates.emplace(std::make_pair(prefix.back(), vertices), Deviation(prefix, i));
             }
-            return ans;
         }
+        return found;
     }
 }
@@ -6,10 +6,73 @@
 #include <vector>
 #include <queue>
 #include "Graph.hpp"
+#include "BitMatrix.hpp"
+#include "SparseMatrix.hpp"
+#include <utility>
 #include <string>
+#include <limits>
 
 
 namespace Algorithms {
+    /**
+     * @brief A weighted edge between two vertices.
+     */
+    struct Edge {
+        int u; ///< One endpoint.
+        int v; ///< The other endpoint.
+        int weight; ///< The weight of the edge.
+    };
+
+    /**
+     * @brief The edges and total weight of a minimum spanning forest.
+     */
+    struct SpanningForest {
+        std::vector<Edge> edges; ///< The forest edges, u < v, in the order they were chosen.
+        long long totalWeight = 0; ///< The sum of the edge weights.
+    };
+
+    /**
+     * @brief The algorithm used by minimumSpanningForest.
+     */
+    enum class MSTMethod {
+        Prim, ///< Dense O(n^2) Prim straight over the adjacency matrix.
+        Kruskal, ///< Kruskal over radix-sorted edges, O(n^2 + E alpha(n)).
+        Boruvka ///< Parallel Boruvka rounds over adjacency lists.
+    };
+
+    /**
+     * @brief All-pairs distances with next-hop information for path reconstruction.
+     */
+    struct DistanceTable {
+        static constexpr long long INF = std::numeric_limits<long long>::max() / 4; ///< Distance of unreachable pairs.
+
+        int n = 0; ///< Number of vertices.
+        std::vector<long long> dist; ///< Row-major n*n distances, INF if j is unreachable from i.
+        std::vector<int> next; ///< Row-major n*n first vertex after i on a shortest i->j path, -1 if none.
+        bool negativeCycle = false; ///< True if the graph has a negative cycle (the table is then not valid).
+
+        /**
+         * @brief Returns the distance from i to j (INF if unreachable).
+         */
+        long long distance(int i, int j) const;
+
+        /**
+         * @brief Reconstructs a shortest path from i to j.
+         * @return The vertices of the path from i to j, or an empty vector if j is unreachable
+         *         or the next hops go round a cycle without reaching it.
+         */
+        std::vector<int> path(int i, int j) const;
+    };
+
+    /**
+     * @brief The algorithm used by allPairsShortestPaths.
+     */
+    enum class APSPMethod {
+        Auto, ///< Floyd-Warshall for dense graphs, Johnson for sparse ones.
+        FloydWarshall, ///< Cache-blocked, multithreaded Floyd-Warshall, O(n^3).
+        Johnson ///< One Bellman-Ford reweighting, then a Dijkstra per source in parallel, O(nE log n).
+    };
+
     /**
      * @brief Checks if the given graph is connected.
      * 
@@ -52,4 +115,608 @@ namespace Algorithms {
      */
     std::string negativeCycle(Graph g);
 
-}
\ No newline at end of file
+    /**
+     * @brief Finds vertex-disjoint negative cycles anywhere in the graph.
+     *
+     * Every vertex starts at distance 0 (a virtual super-source), so cycles are found
+     * regardless of which vertices can reach them. Relaxation is queue based and stops
+     * as soon as the distances settle; the predecessor graph is checked for cycles every
+     * n relaxations. Each cycle found is recorded and its vertices are removed before the
+     * search continues, so once it returns the rest of the graph has no negative cycle.
+     *
+     * @param g The Graph object representing the graph.
+     * @return std::vector<std::vector<int>> The cycles, each listed along its edges and
+     *         closed by repeating its first vertex (e.g. {0, 3, 2, 1, 0}).
+     */
+    std::vector<std::vector<int>> negativeCycles(const Graph& g);
+
+    /**
+     * @brief Finds a minimum spanning forest of the graph.
+     *
+     * The graph is treated as undirected: u and v are joined if g[u][v] or g[v][u] is
+     * non-zero, with the smaller of the two non-zero weights. A disconnected graph gets
+     * one tree per connected component. All three methods return a forest of the same
+     * total weight.
+     *
+     * @param g The Graph object representing the graph.
+     * @param method The algorithm to use.
+     * @return SpanningForest The forest edges and their total weight.
+     */
+    SpanningForest minimumSpanningForest(const Graph& g, MSTMethod method = MSTMethod::Prim);
+
+    /**
+     * @brief Computes the shortest distance between every ordered pair of vertices.
+     *
+     * Edges are directed: g[u][v] != 0 is an edge u->v of weight g[u][v]. Negative
+     * weights are allowed; if the graph has a negative cycle the result has
+     * negativeCycle set and its distances must not be used.
+     *
+     * @param g The Graph object representing the graph.
+     * @param method The algorithm to use.
+     * @return DistanceTable The distance and next-hop matrices.
+     */
+    DistanceTable allPairsShortestPaths(const Graph& g, APSPMethod method = APSPMethod::Auto);
+
+    /**
+     * @brief Computes the transitive closure of the graph as a packed reachability matrix.
+     *
+     * Uses a bit-parallel Warshall: for each k, every row i with bit k set ORs in row k,
+     * 64 columns per word. Rows are processed in blocks of 64 values of k, with all rows
+     * outside the block split across threads.
+     *
+     * @param g The Graph object representing the graph (g[u][v] != 0 is an edge u->v).
+     * @return BitMatrix Entry (u, v) is set if there is a path of length at least 1 from u
+     *         to v; query it in O(1) with get(u, v).
+     */
+    BitMatrix transitiveClosure(const Graph& g);
+
+    /**
+     * @brief Computes the PageRank of every vertex.
+     *
+     * Every non-zero entry g[u][v] is a link u->v (weights are ignored). The iteration is
+     * pull-based over the transposed adjacency, so each vertex sums its in-links without
+     * write conflicts and vertices are split across threads. The rank of dangling vertices
+     * (no out-links) is spread evenly over all vertices.
+     *
+     * @param g The Graph object representing the graph.
+     * @param damping The probability of following a link rather than teleporting.
+     * @param tolerance Stops once the L1 change of the ranks in one iteration is below this.
+     * @param maxIterations Stops after this many iterations.
+     * @return std::vector<double> The rank of every vertex; the ranks sum to 1.
+     */
+    std::vector<double> pageRank(const Graph& g, double damping = 0.85, double tolerance = 1e-10, int maxIterations = 100);
+
+    /**
+     * @brief Computes the PageRank of every vertex of a sparse adjacency matrix.
+     */
+    std::vector<double> pageRank(const SparseMatrix& adjacency, double damping = 0.85, double tolerance = 1e-10,
+                                 int maxIterations = 100);
+
+    /**
+     * @brief Approximates the PageRank personalised to one seed vertex by local forward push.
+     *
+     * Starts with all residual mass on the seed and repeatedly pushes a vertex whose
+     * residual exceeds epsilon times its out-degree. Only vertices near the seed are ever
+     * touched, so the cost depends on epsilon and not on the graph size. Every estimate is
+     * below the true personalised rank by at most epsilon times the vertex out-degree.
+     * For repeated queries, build the SparseMatrix once and use the overload that takes it.
+     *
+     * @param g The Graph object representing the graph.
+     * @param seed The vertex the random walk restarts at.
+     * @param damping The probability of following a link rather than restarting.
+     * @param epsilon The residual threshold per unit of out-degree.
+     * @return The (vertex, score) pairs with a non-zero score, highest score first.
+     * @throws std::invalid_argument if seed is not a vertex of the graph.
+     */
+    std::vector<std::pair<int, double>> personalizedPageRank(const Graph& g, int seed, double damping = 0.85,
+                                                             double epsilon = 1e-6);
+
+    /**
+     * @brief Approximates the personalised PageRank on a prebuilt sparse adjacency matrix.
+     */
+    std::vector<std::pair<int, double>> personalizedPageRank(const SparseMatrix& adjacency, int seed,
+                                                             double damping = 0.85, double epsilon = 1e-6);
+
+    /**
+     * @brief How betweenness measures path length.
+     */
+    enum class BetweennessMethod {
+        Unweighted, ///< Every edge has length 1; one BFS per source.
+        Weighted ///< Edges have their (positive) weights as length; one Dijkstra per source.
+    };
+
+    /**
+     * @brief Computes the betweenness centrality of every vertex with Brandes' algorithm.
+     *
+     * The score of v sums, over ordered pairs (s, t) with s, t and v distinct, the fraction
+     * of shortest s->t paths passing through v. On an undirected graph (symmetric matrix)
+     * every pair is counted in both directions, so halve the scores for the usual
+     * undirected values. Sources are split across threads, each adding its dependencies
+     * into its own accumulator; the accumulators are summed at the end.
+     *
+     * With samples > 0, only that many distinct sources are drawn at random and the sum is
+     * scaled by n / samples. See betweennessSampleSize for the error bound.
+     *
+     * @param g The Graph object representing the graph.
+     * @param method Whether paths are counted in edges or in total weight.
+     * @param samples The number of sampled sources, or 0 (or at least n) for the exact scores.
+     * @param seed The seed of the source sampling.
+     * @return std::vector<double> The betweenness of every vertex.
+     * @throws std::invalid_argument if samples is negative, or the method is Weighted and
+     *         the graph has a negative edge.
+     */
+    std::vector<double> betweenness(const Graph& g, BetweennessMethod method = BetweennessMethod::Unweighted,
+                                    int samples = 0, unsigned int seed = 1);
+
+    /**
+     * @brief Number of sampled sources that makes sampled betweenness accurate.
+     *
+     * With this many samples, every vertex's estimate is within epsilon * n * (n - 2) of
+     * its exact betweenness, for all vertices at once, with probability at least
+     * 1 - delta (Hoeffding's bound with a union bound over the n vertices).
+     *
+     * @param n The number of vertices.
+     * @param epsilon The error as a fraction of the largest possible n * (n - 2).
+     * @param delta The allowed failure probability.
+     * @return int The number of samples, at most n.
+     * @throws std::invalid_argument if epsilon or delta is not in (0, 1).
+     */
+    int betweennessSampleSize(int n, double epsilon, double delta);
+
+    /**
+     * @brief Triangle counts of an undirected graph.
+     */
+    struct TriangleCounts {
+        long long total = 0; ///< Number of triangles.
+        std::vector<long long> perVertex; ///< Number of triangles through each vertex.
+        std::vector<std::pair<int, int>> edges; ///< Every edge once as (u, v) with u < v, in increasing order.
+        std::vector<long long> perEdge; ///< Number of triangles through each entry of edges.
+    };
+
+    /**
+     * @brief Counts the triangles of the graph, treated as undirected.
+     *
+     * Vertices are ranked by degree and every edge is oriented towards the higher rank, so
+     * each triangle is found exactly once, from its lowest vertex, and no vertex has more
+     * than O(sqrt(E)) out-edges. Dense graphs intersect the out-neighbourhoods as packed
+     * bit rows (word AND and popcount); sparse graphs merge sorted out-lists. Vertices are
+     * split across threads. Self-loops are ignored.
+     *
+     * @param g The Graph object representing the graph (u, v adjacent if g[u][v] or g[v][u] is non-zero).
+     * @return long long The number of triangles.
+     */
+    long long triangleCount(const Graph& g);
+
+    /**
+     * @brief Counts the triangles of the graph, in total, per vertex and per edge.
+     *
+     * Uses the same degree ordering and merges sorted out-lists, adding each triangle to
+     * its three vertices and three edges in per-thread accumulators that are summed at the end.
+     *
+     * @param g The Graph object representing the graph, treated as undirected.
+     * @return TriangleCounts The total, per-vertex and per-edge counts.
+     */
+    TriangleCounts triangles(const Graph& g);
+
+    /**
+     * @brief Computes the local clustering coefficient of every vertex.
+     *
+     * The coefficient of v is the number of triangles through v divided by d(v)(d(v) - 1) / 2,
+     * the number of pairs of its neighbours; it is 0 for vertices of degree below 2.
+     *
+     * @param g The Graph object representing the graph, treated as undirected.
+     * @return std::vector<double> The clustering coefficient of every vertex.
+     */
+    std::vector<double> clusteringCoefficients(const Graph& g);
+
+    /**
+     * @brief The algorithm used by coreNumbers.
+     */
+    enum class CoreMethod {
+        Peeling, ///< Sequential bucket peeling (Batagelj-Zaversnik), O(V + E).
+        LevelSynchronous ///< Parallel rounds that peel every vertex of degree <= k at once.
+    };
+
+    /**
+     * @brief The k-core decomposition of an undirected graph.
+     */
+    struct CoreDecomposition {
+        std::vector<int> core; ///< Core number of every vertex: the largest k whose k-core contains it.
+        std::vector<int> order; ///< Degeneracy ordering: each vertex has at most degeneracy neighbours after it.
+        int degeneracy = 0; ///< The largest core number.
+    };
+
+    /**
+     * @brief Computes the core number of every vertex and a degeneracy ordering.
+     *
+     * The k-core is what remains after repeatedly deleting vertices of degree below k.
+     * Peeling keeps the vertices in buckets by current degree and always removes one of
+     * minimum degree. The level-synchronous variant removes every vertex of degree <= k in
+     * one round, decrementing the neighbours' degrees in parallel with atomics, and raises
+     * k once nothing is left to remove. Both return the vertices in the order they were
+     * removed, which is a degeneracy ordering.
+     *
+     * @param g The Graph object representing the graph, treated as undirected (self-loops ignored).
+     * @param method The algorithm to use.
+     * @return CoreDecomposition The core numbers, the ordering and the degeneracy.
+     */
+    CoreDecomposition coreNumbers(const Graph& g, CoreMethod method = CoreMethod::Peeling);
+
+    /**
+     * @brief The cut vertices, bridges and biconnected components of an undirected graph.
+     */
+    struct Biconnectivity {
+        std::vector<int> articulationPoints; ///< Vertices whose removal disconnects their component, sorted.
+        std::vector<std::pair<int, int>> bridges; ///< Edges whose removal disconnects their component, as (u, v) with u < v, sorted.
+        std::vector<std::vector<int>> components; ///< Vertices of every biconnected component, each sorted; the list is sorted.
+    };
+
+    /**
+     * @brief Finds articulation points, bridges and biconnected components in O(V + E).
+     *
+     * Runs Tarjan's low-link depth-first search with an explicit stack instead of
+     * recursion, so path-like graphs of any length cannot overflow the call stack. Edges
+     * are pushed on a second stack as they are explored; whenever a child's low-link does
+     * not reach above its parent, the edges above the tree edge form one biconnected
+     * component. Each bridge forms a component of its own; isolated vertices belong to none.
+     *
+     * @param g The Graph object representing the graph, treated as undirected (self-loops ignored).
+     * @return Biconnectivity The articulation points, bridges and components.
+     */
+    Biconnectivity biconnectedComponents(const Graph& g);
+
+    /**
+     * @brief The result of topologicalOrder: an order of the vertices, or a cycle.
+     */
+    struct TopologicalOrder {
+        bool acyclic = true; ///< True if the graph is a DAG.
+        std::vector<int> order; ///< Every vertex before its out-neighbours (empty if not acyclic).
+        std::vector<int> cycle; ///< A directed cycle closed by repeating its first vertex (e.g. {1, 2, 1}), if not acyclic.
+    };
+
+    /**
+     * @brief Orders the vertices so every edge goes forward, or finds a directed cycle.
+     *
+     * Kahn's algorithm repeatedly removes a vertex with no remaining in-edges, using a
+     * queue over adjacency lists. If some vertices are never removed, each of them still
+     * has an in-edge from another, so walking those in-edges backwards must repeat a
+     * vertex; the walk gives the cycle.
+     *
+     * @param g The Graph object representing the graph (g[u][v] != 0 is an edge u->v).
+     * @return TopologicalOrder The order, or the cycle.
+     */
+    TopologicalOrder topologicalOrder(const Graph& g);
+
+    /**
+     * @brief Whether dagPaths minimises or maximises the path weight.
+     */
+    enum class PathObjective {
+        Shortest, ///< Minimum total weight.
+        Longest ///< Maximum total weight.
+    };
+
+    /**
+     * @brief Single-source path weights in a DAG.
+     */
+    struct DagPaths {
+        int source = -1; ///< The source vertex.
+        std::vector<long long> dist; ///< Best path weight from the source, DistanceTable::INF if unreachable.
+        std::vector<int> parent; ///< Previous vertex on a best path, -1 for the source and unreachable vertices.
+
+        /**
+         * @brief Reconstructs the best path from the source to v.
+         * @return The vertices of the path, or an empty vector if v is unreachable.
+         */
+        std::vector<int> path(int v) const;
+    };
+
+    /**
+     * @brief Computes shortest or longest paths from a source in a DAG in O(V + E).
+     *
+     * Every edge is relaxed once, in topological order, so negative weights are fine.
+     *
+     * @param g The Graph object representing the graph.
+     * @param source The source vertex.
+     * @param objective Whether to minimise or maximise the total weight.
+     * @return DagPaths The path weights and parents.
+     * @throws std::invalid_argument if the source is out of range or the graph has a cycle.
+     */
+    DagPaths dagPaths(const Graph& g, int source, PathObjective objective = PathObjective::Shortest);
+
+    /**
+     * @brief The heaviest path of a DAG.
+     */
+    struct CriticalPath {
+        long long length = 0; ///< Total weight of the path.
+        std::vector<int> path; ///< The vertices of the path (a single vertex if the graph has no edges).
+    };
+
+    /**
+     * @brief Finds the path of maximum total weight in a DAG, starting anywhere.
+     *
+     * With jobs as vertices and durations on the edges, this is the critical path.
+     *
+     * @param g The Graph object representing the graph.
+     * @return CriticalPath The weight and the vertices of the path (empty for an empty graph).
+     * @throws std::invalid_argument if the graph has a cycle.
+     */
+    CriticalPath criticalPath(const Graph& g);
+
+    /**
+     * @brief A maximum flow and the minimum cut it certifies.
+     */
+    struct FlowResult {
+        long long value = 0; ///< The value of the maximum flow, equal to the minimum cut capacity.
+        std::vector<int> sourceSide; ///< Vertices reachable from the source in the residual graph, sorted; the rest form the sink side.
+        std::vector<std::vector<int>> flow; ///< flow[u][v]: flow sent along u->v (only filled if requested).
+    };
+
+    /**
+     * @brief Computes a maximum flow from source to sink with push-relabel.
+     *
+     * g[u][v] is the capacity of u->v. Vertices are discharged highest label first over a
+     * residual graph that pairs u->v with v->u. The gap heuristic lifts every vertex
+     * above an empty label straight to the source side, and a global relabel (a backward
+     * BFS from the sink, then from the source) resets all labels to exact distances
+     * after every n relabels. Edges from the source side to the sink side form a minimum cut.
+     *
+     * @param g The Graph object representing the graph.
+     * @param source The source vertex.
+     * @param sink The sink vertex.
+     * @param withFlow Whether to fill FlowResult::flow with the flow on every edge.
+     * @return FlowResult The flow value, the source side of a minimum cut and, if asked, the flow.
+     * @throws std::invalid_argument if a vertex is out of range, source equals sink, or a
+     *         capacity is negative.
+     */
+    FlowResult maxFlow(const Graph& g, int source, int sink, bool withFlow = false);
+
+    /**
+     * @brief A matching: a set of edges no two of which share a vertex.
+     */
+    struct Matching {
+        std::vector<int> mate; ///< The vertex matched to each vertex, -1 if unmatched.
+        std::vector<std::pair<int, int>> pairs; ///< The matched edges as (a, b) with a on side A, sorted.
+    };
+
+    /**
+     * @brief Finds a maximum matching of a bipartite graph with Hopcroft-Karp in O(E sqrt(V)).
+     *
+     * The sides are the two-coloring isBipartite computes. Each phase builds BFS layers
+     * from the free vertices of side A and then augments along vertex-disjoint shortest
+     * paths with a depth-first search that keeps its own stack.
+     *
+     * @param g The Graph object representing the graph, treated as undirected.
+     * @return Matching The matched pairs and the partner of every vertex.
+     * @throws std::invalid_argument if the graph is not bipartite.
+     */
+    Matching maxBipartiteMatching(const Graph& g);
+
+    /**
+     * @brief An assignment of every row of a cost matrix to a distinct column.
+     */
+    struct Assignment {
+        long long cost = 0; ///< The total cost.
+        std::vector<int> column; ///< The column assigned to each row.
+    };
+
+    /**
+     * @brief Solves the assignment problem with the Hungarian algorithm in O(n^3).
+     *
+     * g[i][j] is the cost of giving task j to worker i; zero is an ordinary cost here,
+     * not a missing edge. Rows are added one at a time, each by a Dijkstra-like search
+     * over reduced costs kept non-negative by row and column potentials. To maximise,
+     * pass -g.
+     *
+     * @param g The cost matrix.
+     * @return Assignment The minimum total cost and the column of each row.
+     */
+    Assignment minimumCostAssignment(const Graph& g);
+
+    /**
+     * @brief The vertex order used by greedyColoring.
+     */
+    enum class ColoringMethod {
+        Natural, ///< Vertices in index order.
+        LargestFirst, ///< Vertices by decreasing degree.
+        SmallestLast, ///< Reverse degeneracy ordering; uses at most degeneracy + 1 colors.
+        Speculative ///< Parallel: color optimistically, then re-color the conflicts (Gebremedhin-Manne).
+    };
+
+    /**
+     * @brief A proper vertex coloring.
+     */
+    struct Coloring {
+        std::vector<int> color; ///< The color of every vertex, from 0.
+        int colors = 0; ///< The number of colors used.
+    };
+
+    /**
+     * @brief Colors the vertices so adjacent vertices differ, giving each the smallest free color.
+     *
+     * The sequential methods visit the vertices in the chosen order. The speculative
+     * method colors all uncolored vertices in parallel from their neighbours' current
+     * colors, then checks every edge; of two adjacent vertices with the same color the
+     * one with the larger index is queued again. Rounds repeat until there is no
+     * conflict, which usually takes very few rounds.
+     *
+     * @param g The Graph object representing the graph, treated as undirected (self-loops ignored).
+     * @param method The vertex order, or the parallel speculative mode.
+     * @return Coloring The color of every vertex and the number of colors.
+     */
+    Coloring greedyColoring(const Graph& g, ColoringMethod method = ColoringMethod::SmallestLast);
+
+    /**
+     * @brief The algorithm used by globalMinCut.
+     */
+    enum class MinCutMethod {
+        StoerWagner, ///< Deterministic, O(n^3) time and O(n^2) memory.
+        KargerStein ///< Randomized recursive contraction; independent trials run in parallel.
+    };
+
+    /**
+     * @brief A cut of the vertex set into two non-empty sides.
+     */
+    struct GlobalCut {
+        long long value = 0; ///< Total weight of the edges between the sides.
+        std::vector<int> side; ///< One side, sorted.
+        std::vector<int> otherSide; ///< The other side, sorted.
+    };
+
+    /**
+     * @brief Finds a minimum weight cut of the graph, treated as undirected.
+     *
+     * u and v are joined if g[u][v] or g[v][u] is non-zero, with the smaller of the two
+     * non-zero weights, as in minimumSpanningForest. Stoer-Wagner runs n - 1 maximum
+     * adjacency orderings, each merging the last two vertices, and is always exact.
+     * Karger-Stein contracts random edges (chosen with probability proportional to
+     * weight) down to n / sqrt(2) vertices twice and recurses on both; each trial finds a
+     * minimum cut with probability Omega(1 / log n), so O(log^2 n) trials fail only rarely.
+     *
+     * @param g The Graph object representing the graph.
+     * @param method The algorithm to use.
+     * @param trials Karger-Stein trials; 0 picks ceil(log2 n)^2.
+     * @param seed The seed of the Karger-Stein random choices.
+     * @return GlobalCut The cut value and the two sides.
+     * @throws std::invalid_argument if the graph has fewer than 2 vertices or a negative weight.
+     */
+    GlobalCut globalMinCut(const Graph& g, MinCutMethod method = MinCutMethod::StoerWagner, int trials = 0,
+                           unsigned int seed = 1);
+
+    /**
+     * @brief Lists every maximal clique of the graph, treated as undirected.
+     *
+     * Bron-Kerbosch with Tomita pivoting. The outer loop follows a degeneracy ordering:
+     * the cliques whose earliest vertex is v are searched inside the neighbourhood of v
+     * only, re-indexed so the candidate and excluded sets are bit rows of at most
+     * degree(v) bits and every intersection is a few word ANDs. These top-level branches
+     * are independent and run in parallel.
+     *
+     * @param g The Graph object representing the graph (self-loops ignored).
+     * @param minimumSize Only cliques with at least this many vertices are returned.
+     * @return The cliques, each sorted, in increasing order.
+     */
+    std::vector<std::vector<int>> maximalCliques(const Graph& g, int minimumSize = 1);
+
+    /**
+     * @brief Finds a maximum clique of the graph, treated as undirected.
+     *
+     * Branch and bound over the same degeneracy-ordered neighbourhoods: a greedy coloring
+     * of the candidates (bit-parallel, one color class at a time) bounds how far the
+     * current clique can grow, and branches that cannot beat the best clique so far are
+     * cut. Threads share the size of the best clique found.
+     *
+     * @param g The Graph object representing the graph (self-loops ignored).
+     * @return std::vector<int> The vertices of a maximum clique, sorted (empty for an empty graph).
+     */
+    std::vector<int> maximumClique(const Graph& g);
+
+    /**
+     * @brief How diameter and eccentricities measure distance.
+     */
+    enum class DistanceMetric {
+        Hops, ///< Every edge has length 1; BFS.
+        Weights ///< Edges have their (positive) weights as length; Dijkstra.
+    };
+
+    /**
+     * @brief Computes the diameter: the largest distance between two vertices that are connected.
+     *
+     * The graph is treated as undirected, with the smaller non-zero weight of the two
+     * directions. With Hops, each component runs a double sweep for a lower bound and a
+     * central start vertex, then iFUB: the vertices are taken by decreasing distance from
+     * the centre, and once the best eccentricity found beats twice the next level the
+     * remaining vertices cannot matter. With Weights, Dijkstra runs from vertices chosen
+     * by their eccentricity bounds until no vertex can still exceed the best found. Both
+     * are exact and usually need only a handful of searches.
+     *
+     * @param g The Graph object representing the graph.
+     * @param metric Whether distances count edges or weights.
+     * @return long long The diameter (0 for a graph without edges).
+     * @throws std::invalid_argument if the metric is Weights and the graph has a negative weight.
+     */
+    long long diameter(const Graph& g, DistanceMetric metric = DistanceMetric::Hops);
+
+    /**
+     * @brief Computes the eccentricity of every vertex: its largest distance to a vertex it can reach.
+     *
+     * Keeps a lower and an upper bound on every eccentricity. Each search from v tightens
+     * them for every w, since ecc(w) lies between max(d(v, w), ecc(v) - d(v, w)) and
+     * ecc(v) + d(v, w). Sources alternate between the largest upper bound and the smallest
+     * lower bound, and stop once every vertex is settled.
+     *
+     * @param g The Graph object representing the graph, treated as undirected.
+     * @param metric Whether distances count edges or weights.
+     * @return std::vector<long long> The eccentricity of every vertex.
+     * @throws std::invalid_argument if the metric is Weights and the graph has a negative weight.
+     */
+    std::vector<long long> eccentricities(const Graph& g, DistanceMetric metric = DistanceMetric::Hops);
+
+    /**
+     * @brief Closeness and harmonic centrality of every vertex.
+     */
+    struct Closeness {
+        std::vector<double> closeness; ///< Wasserman-Faust closeness: ((r - 1) / sum of distances) * ((r - 1) / (n - 1)), for the r vertices v reaches (itself included); 0 if it reaches none.
+        std::vector<double> harmonic; ///< Sum of 1 / d(v, u) over the vertices u != v that v reaches.
+    };
+
+    /**
+     * @brief Computes closeness and harmonic centrality from hop distances.
+     *
+     * Distances are counted in edges along g[u][v] != 0 (weights ignored), from v outwards.
+     * The BFS from every vertex runs in a multi-source bit-parallel BFS (MS-BFS): up to 256
+     * sources share one traversal, every vertex keeps one bit per source in a few words,
+     * and each adjacency scan advances all of them with a word-wide OR. Batches of sources
+     * are split across threads.
+     *
+     * @param g The Graph object representing the graph.
+     * @return Closeness Both scores of every vertex.
+     */
+    Closeness closeness(const Graph& g);
+
+    /**
+     * @brief Computes the hop distance between every ordered pair of vertices.
+     *
+     * Runs the same MS-BFS as closeness, writing each source's levels into its row. The
+     * BFS also reports the vertex that first delivered each source to a vertex, so its
+     * first hop is copied from that vertex's and the next-hop matrix is filled on the way.
+     *
+     * @param g The Graph object representing the graph (g[u][v] != 0 is an edge u->v).
+     * @return DistanceTable The hop distances and next-hop matrix, usable with DistanceTable::path.
+     */
+    DistanceTable hopDistances(const Graph& g);
+
+    /**
+     * @brief One path of a ranked path query.
+     */
+    struct RankedPath {
+        long long cost = 0; ///< Total weight of the path.
+        std::vector<int> vertices; ///< The vertices from start to end.
+    };
+
+    /**
+     * @brief Finds the k cheapest loopless paths from start to end with Yen's algorithm.
+     *
+     * Every non-zero g[u][v] is an edge u->v whose weight must be positive. Each new path
+     * is the cheapest deviation from the last one found: for every spur vertex on it, the
+     * root before it is blocked and the edges that earlier paths with the same root take
+     * out of the spur vertex are skipped. Those bans are a mask checked during the search,
+     * not a copy of the graph. Every spur search runs A* in one reused workspace, guided
+     * by exact distances to end computed once on the reverse graph, so it mostly explores
+     * the detour itself.
+     *
+     * @param g The Graph object representing the graph.
+     * @param start The start vertex.
+     * @param end The end vertex.
+     * @param k The number of paths wanted.
+     * @return std::vector<RankedPath> Up to k distinct paths by increasing cost;
+     *         fewer if the graph has fewer loopless paths.
+     * @throws std::invalid_argument if a vertex is out of range, k is negative, or an edge weight is negative.
+     */
+    std::vector<RankedPath> kShortestPaths(const Graph& g, int start, int end, int k);
+
+    /**
+     * @brief Finds the k cheapest loopless paths on a prebuilt sparse adjacency matrix.
+     */
+    std::vector<RankedPath> kShortestPaths(const SparseMatrix& adjacency, int start, int end, int k);
+
+}
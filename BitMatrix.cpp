@@ -0,0 +1,132 @@
+/*
+ * Author: yehonatan768@gmail.com
+ * ID: 213637424
+ */
+
+#include "BitMatrix.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Creates an n x n matrix with every entry false.
+ * @param n The number of rows and columns.
+ * @throws std::invalid_argument if n is negative.
+ */
+BitMatrix::BitMatrix(int n) : size(n), words((n + 63) / 64) {
+    if (n < 0) {
+        throw std::invalid_argument("Invalid matrix: The size must not be negative.");
+    }
+    this->bits.assign(static_cast<size_t>(n) * this->words, 0);
+}
+
+/**
+ * @brief Packs the adjacency matrix of a graph: entry (u, v) is set if g[u][v] != 0.
+ * @param graph The graph to pack.
+ */
+BitMatrix::BitMatrix(const Graph& graph) : BitMatrix(static_cast<int>(graph.getMatrix().size())) {
+    const std::vector<std::vector<int>>& g = graph.getMatrix();
+    for (int u = 0; u < this->size; ++u) {
+        uint64_t* r = this->row(u);
+        for (int v = 0; v < this->size; ++v) {
+            if (g[u][v] != 0) r[v >> 6] |= uint64_t(1) << (v & 63);
+        }
+    }
+}
+
+/**
+ * @brief Counts the set entries of row u.
+ */
+int BitMatrix::countRow(int u) const {
+    const uint64_t* r = this->row(u);
+    int count = 0;
+    for (int w = 0; w < this->words; ++w) count += __builtin_popcountll(r[w]);
+    return count;
+}
+
+/**
+ * @brief Counts all set entries.
+ */
+long long BitMatrix::count() const {
+    long long count = 0;
+    for (uint64_t word : this->bits) count += __builtin_popcountll(word);
+    return count;
+}
+
+/**
+ * @brief Boolean (OR, AND) matrix product, using the Method of Four Russians.
+ *
+ * The subset tables are built for a batch of groups at a time (about 16 MB), then every
+ * row of the result ORs in one table row per non-zero byte of its row in this matrix.
+ * @param other The matrix to multiply by.
+ * @return The boolean product.
+ * @throws std::invalid_argument if the matrices are not of the same size.
+ */
+BitMatrix BitMatrix::operator*(const BitMatrix& other) const {
+    if (this->size != other.size) {
+        throw std::invalid_argument("Matrix multiplication requires matrices of the same size.");
+    }
+
+    int n = this->size;
+    int w = this->words;
+    BitMatrix result(n);
+    if (n == 0) return result;
+
+    int groups = (n + 7) / 8;
+    size_t tableWords = static_cast<size_t>(256) * w;
+    int batch = static_cast<int>(std::max<size_t>(1, (static_cast<size_t>(1) << 21) / tableWords));
+    batch = std::min(batch, groups);
+    std::vector<uint64_t> tables(static_cast<size_t>(batch) * tableWords);
+
+    for (int first = 0; first < groups; first += batch) {
+        int last = std::min(first + batch, groups);
+
+        // table[subset] = OR of the rows of other selected by the bits of subset
+        Parallel::forRange(first, last, 1, [&](int lo, int hi) {
+            for (int group = lo; group < hi; ++group) {
+                uint64_t* table = tables.data() + static_cast<size_t>(group - first) * tableWords;
+                std::fill(table, table + w, 0);
+                for (int subset = 1; subset < 256; ++subset) {
+                    int k = group * 8 + __builtin_ctz(subset);
+                    const uint64_t* prev = table + static_cast<size_t>(subset & (subset - 1)) * w;
+                    uint64_t* dst = table + static_cast<size_t>(subset) * w;
+                    if (k < n) {
+                        const uint64_t* src = other.row(k);
+                        for (int x = 0; x < w; ++x) dst[x] = prev[x] | src[x];
+                    } else {
+                        std::copy(prev, prev + w, dst);
+                    }
+                }
+            }
+        });
+
+        Parallel::forRange(0, n, std::max(1, 4096 / std::max(w, 1)), [&](int lo, int hi) {
+            for (int i = lo; i < hi; ++i) {
+                const uint64_t* a = this->row(i);
+                uint64_t* out = result.row(i);
+                for (int group = first; group < last; ++group) {
+                    int subset = (a[group >> 3] >> ((group & 7) * 8)) & 0xFF;
+                    if (subset == 0) continue;
+                    const uint64_t* src = tables.data() + static_cast<size_t>(group - first) * tableWords
+                                          + static_cast<size_t>(subset) * w;
+                    for (int x = 0; x < w; ++x) out[x] |= src[x];
+                }
+            }
+        });
+    }
+    return result;
+}
+
+/**
+ * @brief Compares two matrices for equality.
+ */
+bool BitMatrix::operator==(const BitMatrix& other) const {
+    return this->size == other.size && this->bits == other.bits;
+}
+
+/**
+ * @brief Compares two matrices for inequality.
+ */
+bool BitMatrix::operator!=(const BitMatrix& other) const {
+    return !(*this == other);
+}
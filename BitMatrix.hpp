@@ -0,0 +1,110 @@
+/*
+ * Author: yehonatan768@gmail.com
+ * ID: 213637424
+ */
+
+#ifndef BITMATRIX_HPP
+#define BITMATRIX_HPP
+
+#include <cstdint>
+#include <vector>
+#include "Graph.hpp"
+
+/**
+ * @brief A square boolean matrix packed 64 entries per word, one padded row per vertex.
+ */
+class BitMatrix {
+    private:
+        std::vector<uint64_t> bits; ///< Row-major words, words per row each.
+        int size; ///< Number of rows (and columns).
+        int words; ///< Words per row.
+
+    public:
+        /**
+         * @brief Default constructor initializes an empty matrix.
+         */
+        BitMatrix() : size(0), words(0) {}
+
+        /**
+         * @brief Creates an n x n matrix with every entry false.
+         * @param n The number of rows and columns.
+         * @throws std::invalid_argument if n is negative.
+         */
+        explicit BitMatrix(int n);
+
+        /**
+         * @brief Packs the adjacency matrix of a graph: entry (u, v) is set if g[u][v] != 0.
+         * @param graph The graph to pack.
+         */
+        explicit BitMatrix(const Graph& graph);
+
+        /**
+         * @brief Gets the number of rows (and columns).
+         */
+        int getSize() const { return this->size; }
+
+        /**
+         * @brief Gets the number of 64-bit words in each row.
+         */
+        int getWords() const { return this->words; }
+
+        /**
+         * @brief Returns entry (u, v) in O(1).
+         */
+        bool get(int u, int v) const {
+            return (this->bits[static_cast<size_t>(u) * this->words + (v >> 6)] >> (v & 63)) & 1;
+        }
+
+        /**
+         * @brief Sets entry (u, v) to value.
+         */
+        void set(int u, int v, bool value = true) {
+            uint64_t& word = this->bits[static_cast<size_t>(u) * this->words + (v >> 6)];
+            uint64_t mask = uint64_t(1) << (v & 63);
+            word = value ? (word | mask) : (word & ~mask);
+        }
+
+        /**
+         * @brief Gets the packed words of row u.
+         */
+        const uint64_t* row(int u) const { return this->bits.data() + static_cast<size_t>(u) * this->words; }
+
+        /**
+         * @brief Gets the packed words of row u for writing.
+         */
+        uint64_t* row(int u) { return this->bits.data() + static_cast<size_t>(u) * this->words; }
+
+        /**
+         * @brief Counts the set entries of row u.
+         */
+        int countRow(int u) const;
+
+        /**
+         * @brief Counts all set entries.
+         */
+        long long count() const;
+
+        /**
+         * @brief Boolean (OR, AND) matrix product, using the Method of Four Russians.
+         *
+         * Rows of the other matrix are grouped by eight; for each group the OR of every
+         * subset is tabulated once, so each byte of a row of this matrix costs a single
+         * row OR. Rows of the result are split across threads.
+         * @param other The matrix to multiply by.
+         * @return The boolean product.
+         * @throws std::invalid_argument if the matrices are not of the same size.
+         */
+        BitMatrix operator*(const BitMatrix& other) const;
+
+        /**
+         * @brief Compares two matrices for equality.
+         */
+        bool operator==(const BitMatrix& other) const;
+
+        /**
+         * @brief Compares two matrices for inequality.
+         */
+        bool operator!=(const BitMatrix& other) const;
+};
+
+#endif // BITMATRIX_HPP
@@ -10,6 +10,359 @@
 #include <vector>
 #include <algorithm>
 #include <sstream>
+#include "Parallel.hpp"
+#include "SparseMatrix.hpp"
+
+namespace {
+    const int PRODUCT_BLOCK = 256; ///< Columns and inner indices per tile of the matrix product.
+
+    /**
+     * @brief Rows per thread chunk so each chunk of an n x n product does about a million updates.
+     */
+    int productGrain(int n) {
+        long long cells = static_cast<long long>(n) * n;
+        return static_cast<int>(std::max(1LL, (1LL << 20) / std::max(cells, 1LL)));
+    }
+
+    /**
+     * @brief The tiled product kernel shared by every dense matrix product: out += a * b.
+     *
+     * Rows are reached through accessors so the kernel runs over nested vectors, flat
+     * buffers and strided sub-matrices alike. Output rows are split across threads; each
+     * thread walks column tiles and inner-index tiles so the touched part of b stays in
+     * cache, and skips a[i][k] == zero since the zero annihilates the product.
+     * @param n The matrix size.
+     * @param rowA, rowB, rowOut Callables returning a pointer to row i of each matrix.
+     * @param ops Provides add and multiply (static or not).
+     * @param zero The additive identity.
+     */
+    template <typename T, typename Ops, typename RowA, typename RowB, typename RowOut>
+    void tiledProduct(int n, const RowA& rowA, const RowB& rowB, const RowOut& rowOut, const Ops& ops, T zero) {
+        Parallel::forRange(0, n, productGrain(n), [&](int lo, int hi) {
+            for (int jj = 0; jj < n; jj += PRODUCT_BLOCK) {
+                int jEnd = std::min(jj + PRODUCT_BLOCK, n);
+                for (int kk = 0; kk < n; kk += PRODUCT_BLOCK) {
+                    int kEnd = std::min(kk + PRODUCT_BLOCK, n);
+                    for (int i = lo; i < hi; ++i) {
+                        const T* a = rowA(i);
+                        T* out = rowOut(i);
+                        for (int k = kk; k < kEnd; ++k) {
+                            T aik = a[k];
+                            if (aik == zero) continue;
+                            const T* b = rowB(k);
+                            for (int j = jj; j < jEnd; ++j) {
+                                out[j] = ops.add(out[j], ops.multiply(aik, b[j]));
+                            }
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief Plain 64-bit arithmetic; unsigned so that overflow wraps instead of being undefined.
+     */
+    struct WrappingInt64 {
+        long long fromInt(long long x) const { return x; }
+        long long toInt(long long x) const { return x; }
+        long long add(long long a, long long b) const {
+            return static_cast<long long>(static_cast<unsigned long long>(a) + static_cast<unsigned long long>(b));
+        }
+        long long multiply(long long a, long long b) const {
+            return static_cast<long long>(static_cast<unsigned long long>(a) * static_cast<unsigned long long>(b));
+        }
+    };
+
+    /**
+     * @brief 64-bit arithmetic that clamps to the range of long long instead of overflowing.
+     */
+    struct SaturatingInt64 {
+        long long fromInt(long long x) const { return x; }
+        long long toInt(long long x) const { return x; }
+        long long add(long long a, long long b) const {
+            long long r;
+            if (!__builtin_add_overflow(a, b, &r)) return r;
+            return a > 0 ? std::numeric_limits<long long>::max() : std::numeric_limits<long long>::min();
+        }
+        long long multiply(long long a, long long b) const {
+            long long r;
+            if (!__builtin_mul_overflow(a, b, &r)) return r;
+            return (a > 0) == (b > 0) ? std::numeric_limits<long long>::max() : std::numeric_limits<long long>::min();
+        }
+    };
+
+    /**
+     * @brief Arithmetic modulo an odd modulus below 2^63, kept in Montgomery form (R = 2^64).
+     */
+    struct Montgomery {
+        typedef unsigned __int128 Wide;
+        unsigned long long mod;
+        unsigned long long inverse; ///< -mod^-1 mod 2^64.
+        unsigned long long r2; ///< R^2 mod mod.
+
+        explicit Montgomery(unsigned long long modulus) : mod(modulus) {
+            unsigned long long inv = modulus; // correct to 3 bits for odd modulus
+            for (int i = 0; i < 5; ++i) inv *= 2 - modulus * inv;
+            inverse = 0 - inv;
+            unsigned long long r = static_cast<unsigned long long>((static_cast<Wide>(1) << 64) % modulus);
+            r2 = static_cast<unsigned long long>(static_cast<Wide>(r) * r % modulus);
+        }
+
+        unsigned long long reduce(Wide t) const {
+            unsigned long long m = static_cast<unsigned long long>(t) * inverse;
+            unsigned long long u = static_cast<unsigned long long>((t + static_cast<Wide>(m) * mod) >> 64);
+            return u >= mod ? u - mod : u;
+        }
+
+        long long fromInt(long long x) const {
+            long long residue = x % static_cast<long long>(mod);
+            if (residue < 0) residue += mod;
+            return reduce(static_cast<Wide>(residue) * r2);
+        }
+        long long toInt(long long x) const { return reduce(static_cast<unsigned long long>(x)); }
+        long long add(long long a, long long b) const {
+            unsigned long long sum = static_cast<unsigned long long>(a) + static_cast<unsigned long long>(b);
+            return sum >= mod ? sum - mod : sum;
+        }
+        long long multiply(long long a, long long b) const {
+            return reduce(static_cast<Wide>(static_cast<unsigned long long>(a)) * static_cast<unsigned long long>(b));
+        }
+    };
+
+    /**
+     * @brief out = a * b for row-major n x n matrices.
+     */
+    template <typename Acc>
+    void multiplyInto(const std::vector<long long>& a, const std::vector<long long>& b,
+                      std::vector<long long>& out, int n, const Acc& acc) {
+        std::fill(out.begin(), out.end(), 0);
+        tiledProduct(n,
+                     [&a, n](int i) { return a.data() + static_cast<size_t>(i) * n; },
+                     [&b, n](int k) { return b.data() + static_cast<size_t>(k) * n; },
+                     [&out, n](int i) { return out.data() + static_cast<size_t>(i) * n; },
+                     acc, 0LL);
+    }
+
+    /**
+     * @brief Exponentiation by squaring over three reused buffers.
+     */
+    template <typename Acc>
+    std::vector<std::vector<long long>> matrixPower(const std::vector<std::vector<int>>& g,
+                                                   unsigned long long k, const Acc& acc) {
+        int n = g.size();
+        size_t cells = static_cast<size_t>(n) * n;
+        std::vector<long long> base(cells), result, scratch(cells);
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < n; ++j) base[static_cast<size_t>(i) * n + j] = acc.fromInt(g[i][j]);
+        }
+
+        bool started = false;
+        while (k > 0) {
+            if (k & 1) {
+                if (!started) {
+                    result = base;
+                    started = true;
+                } else {
+                    multiplyInto(result, base, scratch, n, acc);
+                    result.swap(scratch);
+                }
+            }
+            k >>= 1;
+            if (k > 0) {
+                multiplyInto(base, base, scratch, n, acc);
+                base.swap(scratch);
+            }
+        }
+        if (!started) {
+            result.assign(cells, 0);
+            for (int i = 0; i < n; ++i) result[static_cast<size_t>(i) * n + i] = acc.fromInt(1);
+        }
+
+        std::vector<std::vector<long long>> ans(n, std::vector<long long>(n));
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < n; ++j) ans[i][j] = acc.toInt(result[static_cast<size_t>(i) * n + j]);
+        }
+        return ans;
+    }
+
+    /**
+     * @brief (+, *) on unsigned ints: wraps modulo 2^32 without undefined behaviour.
+     */
+    struct UnsignedPlusTimes {
+        static unsigned int add(unsigned int a, unsigned int b) { return a + b; }
+        static unsigned int multiply(unsigned int a, unsigned int b) { return a * b; }
+    };
+
+    /**
+     * @brief A square sub-matrix of a row-major buffer.
+     */
+    struct View {
+        unsigned int* data;
+        size_t stride; ///< Distance between rows.
+
+        unsigned int* row(int i) const { return this->data + i * this->stride; }
+        View quadrant(int r, int c, int h) const { return {this->row(r * h) + static_cast<size_t>(c) * h, this->stride}; }
+    };
+
+    /**
+     * @brief out = a + b (or a - b when subtract is set) for h x h views; out may alias a or b.
+     */
+    void combine(View out, View a, View b, int h, bool subtract) {
+        Parallel::forRange(0, h, std::max(1, 65536 / std::max(h, 1)), [&](int lo, int hi) {
+            for (int i = lo; i < hi; ++i) {
+                unsigned int* o = out.row(i);
+                const unsigned int* x = a.row(i);
+                const unsigned int* y = b.row(i);
+                if (subtract) {
+                    for (int j = 0; j < h; ++j) o[j] = x[j] - y[j];
+                } else {
+                    for (int j = 0; j < h; ++j) o[j] = x[j] + y[j];
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief c = a * b for s x s views by Strassen-Winograd (7 products, 15 additions).
+     *
+     * Follows the schedule of Douglas et al., which needs only two temporaries per level
+     * (X for the A side and Y for the B side); the products land directly in the
+     * quadrants of c. Temporaries are taken from work, so one arena serves the whole
+     * recursion.
+     * @param leaf The size at which the tiled kernel takes over.
+     * @param work Free workspace of at least 2/3 s^2 entries.
+     */
+    void winograd(View a, View b, View c, int s, int leaf, unsigned int* work) {
+        if (s <= leaf) {
+            for (int i = 0; i < s; ++i) std::fill(c.row(i), c.row(i) + s, 0u);
+            tiledProduct(s,
+                         [&a](int i) { return a.row(i); },
+                         [&b](int k) { return b.row(k); },
+                         [&c](int i) { return c.row(i); },
+                         UnsignedPlusTimes(), 0u);
+            return;
+        }
+
+        int h = s / 2;
+        size_t quadrant = static_cast<size_t>(h) * h;
+        View x = {work, static_cast<size_t>(h)};
+        View y = {work + quadrant, static_cast<size_t>(h)};
+        unsigned int* next = work + 2 * quadrant;
+        View a11 = a.quadrant(0, 0, h), a12 = a.quadrant(0, 1, h), a21 = a.quadrant(1, 0, h), a22 = a.quadrant(1, 1, h);
+        View b11 = b.quadrant(0, 0, h), b12 = b.quadrant(0, 1, h), b21 = b.quadrant(1, 0, h), b22 = b.quadrant(1, 1, h);
+        View c11 = c.quadrant(0, 0, h), c12 = c.quadrant(0, 1, h), c21 = c.quadrant(1, 0, h), c22 = c.quadrant(1, 1, h);
+
+        combine(x, a11, a21, h, true);   // S3 = A11 - A21
+        combine(y, b22, b12, h, true);   // T3 = B22 - B12
+        winograd(x, y, c21, h, leaf, next); // P7 = S3 T3
+        combine(x, a21, a22, h, false);  // S1 = A21 + A22
+        combine(y, b12, b11, h, true);   // T1 = B12 - B11
+        winograd(x, y, c22, h, leaf, next); // P5 = S1 T1
+        combine(x, x, a11, h, true);     // S2 = S1 - A11
+        combine(y, b22, y, h, true);     // T2 = B22 - T1
+        winograd(x, y, c12, h, leaf, next); // P6 = S2 T2
+        combine(x, a12, x, h, true);     // S4 = A12 - S2
+        winograd(x, b22, c11, h, leaf, next); // P3 = S4 B22
+        winograd(a11, b11, x, h, leaf, next); // P1 = A11 B11
+        combine(c12, x, c12, h, false);  // U2 = P1 + P6
+        combine(c21, c12, c21, h, false); // U3 = U2 + P7
+        combine(c12, c12, c22, h, false); // U4 = U2 + P5
+        combine(c22, c21, c22, h, false); // U7 = U3 + P5 = C22
+        combine(c12, c12, c11, h, false); // U5 = U4 + P3 = C12
+        combine(y, y, b21, h, true);     // T4 = T2 - B21
+        winograd(a22, y, c11, h, leaf, next); // P4 = A22 T4
+        combine(c21, c21, c11, h, true); // U6 = U3 - P4 = C21
+        winograd(a12, b21, c11, h, leaf, next); // P2 = A12 B21
+        combine(c11, x, c11, h, false);  // U1 = P1 + P2 = C11
+    }
+
+    /**
+     * @brief Multiplies two n x n matrices by Strassen-Winograd, halving until the size is
+     * at most crossover.
+     *
+     * The operands are zero-padded to leaf * 2^levels and the workspace arena for all
+     * levels is allocated once up front.
+     */
+    void strassenProduct(const std::vector<std::vector<int>>& a, const std::vector<std::vector<int>>& b, int crossover,
+                         std::vector<std::vector<int>>& ans) {
+        int n = a.size();
+        int leaf = n;
+        int levels = 0;
+        while (leaf > crossover) {
+            leaf = (leaf + 1) / 2;
+            ++levels;
+        }
+        int padded = leaf << levels;
+        size_t cells = static_cast<size_t>(padded) * padded;
+
+        size_t arena = 0;
+        for (int s = padded; s > leaf; s /= 2) arena += 2 * static_cast<size_t>(s / 2) * (s / 2);
+        std::vector<unsigned int> left(cells, 0), right(cells, 0), product(cells), work(arena);
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < n; ++j) {
+                left[static_cast<size_t>(i) * padded + j] = static_cast<unsigned int>(a[i][j]);
+                right[static_cast<size_t>(i) * padded + j] = static_cast<unsigned int>(b[i][j]);
+            }
+        }
+
+        winograd({left.data(), static_cast<size_t>(padded)}, {right.data(), static_cast<size_t>(padded)},
+                 {product.data(), static_cast<size_t>(padded)}, padded, leaf, work.data());
+
+        ans.resize(n);
+        for (int i = 0; i < n; ++i) {
+            ans[i].resize(n);
+            for (int j = 0; j < n; ++j) ans[i][j] = static_cast<int>(product[static_cast<size_t>(i) * padded + j]);
+        }
+    }
+
+    /**
+     * @brief Dot product of an int row with x, using four partial sums so it vectorises.
+     */
+    template <typename T>
+    T dotRow(const int* a, const T* x, int n) {
+        typedef typename Semiring::Wrapping<T>::type U;
+        U s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        int j = 0;
+        for (; j + 4 <= n; j += 4) {
+            s0 += static_cast<U>(a[j]) * static_cast<U>(x[j]);
+            s1 += static_cast<U>(a[j + 1]) * static_cast<U>(x[j + 1]);
+            s2 += static_cast<U>(a[j + 2]) * static_cast<U>(x[j + 2]);
+            s3 += static_cast<U>(a[j + 3]) * static_cast<U>(x[j + 3]);
+        }
+        for (; j < n; ++j) s0 += static_cast<U>(a[j]) * static_cast<U>(x[j]);
+        return static_cast<T>((s0 + s1) + (s2 + s3));
+    }
+
+    /**
+     * @brief Decides whether a * b is cheaper as a sparse (Gustavson) product.
+     *
+     * The sparse product does sum over k of (non-zeros in column k of a) * (non-zeros in
+     * row k of b) multiply-adds; the dense kernel skips zero entries of a but still walks
+     * a full row of b for every non-zero of a. The sparse path wins when its count, with
+     * a margin for the accumulator overhead, is below the dense one, i.e. when both
+     * operands are sparse.
+     */
+    bool sparseProductPays(const std::vector<std::vector<int>>& a, const std::vector<std::vector<int>>& b) {
+        int n = a.size();
+        if (n < 32) return false;
+        std::vector<long long> columnCount(n, 0);
+        double nonZerosA = 0;
+        for (int i = 0; i < n; ++i) {
+            for (int k = 0; k < n; ++k) {
+                if (a[i][k] != 0) ++columnCount[k];
+            }
+        }
+        double flops = 0;
+        for (int k = 0; k < n; ++k) {
+            nonZerosA += columnCount[k];
+            if (columnCount[k] != 0) flops += static_cast<double>(columnCount[k]) * (n - std::count(b[k].begin(), b[k].end(), 0));
+        }
+        return flops * 8 < nonZerosA * n;
+    }
+}
+
+std::atomic<int> Graph::strassenCrossover(4096);
 
 /**
  * @brief Loads a graph from a given adjacency matrix.
@@ -42,16 +395,16 @@ std::string Graph::printGraph() const {
 
 /**
  * @brief Gets the adjacency matrix of the graph.
- * @return The adjacency matrix of the graph.
+ * @return A read-only reference to the adjacency matrix of the graph.
  */
-std::vector<std::vector<int>> Graph::getMatrix() const {
+const std::vector<std::vector<int>>& Graph::getMatrix() const {
     return this->g;
 }
 
 std::ostream& operator<<(std::ostream& os, const Graph& graph) {
     for (int i = 0; i < graph.size; ++i) {
         for (int j = 0; j < graph.size; ++j) {
-            os << std::setw(4)<< graph.getMatrix()[i][j] << " ";
+            os << std::setw(4)<< graph.g[i][j] << " ";
         }
         os << "\n";
     }
@@ -186,7 +539,8 @@ bool Graph::operator>(const Graph& other) const {
     bool thisContainedInOther = true;
     bool otherContainedInThis = true;
 
-    for (int i = 0; i < this->size; ++i) {
+    // stop scanning once neither graph can contain the other
+    for (int i = 0; i < this->size && (thisContainedInOther || otherContainedInThis); ++i) {
         for (int j = 0; j < this->size; ++j) {
             if (this->g[i][j] > other.g[i][j]) {
                 otherContainedInThis = false;
@@ -347,23 +701,52 @@ Graph& Graph::operator*=(int scalar) {
  * @throws std::invalid_argument if the graphs are not of the same size.
  */
 Graph Graph::operator*(const Graph& other) const {
-    if (this->size != other.size) {
+    Graph result;
+    result.assignProduct(*this, other);
+    return result;
+}
+
+/**
+ * @brief Stores a * b in this graph, reusing the storage of its rows.
+ * @param a The left factor.
+ * @param b The right factor.
+ * @throws std::invalid_argument if the graphs are not of the same size.
+ */
+void Graph::assignProduct(const Graph& a, const Graph& b) {
+    if (a.size != b.size) {
         throw std::invalid_argument("Matrix multiplication requires matrices of the same size.");
     }
+    if (this == &a || this == &b) {
+        Graph result;
+        result.assignProduct(a, b);
+        std::swap(this->g, result.g);
+        this->size = result.size;
+        return;
+    }
 
-    Graph result;
-    result.size = this->size;
-    result.g.resize(this->size, std::vector<int>(this->size, 0));
-
-    for (int i = 0; i < this->size; ++i) {
-        for (int j = 0; j < this->size; ++j) {
-            for (int k = 0; k < this->size; ++k) {
-                result.g[i][j] += this->g[i][k] * other.g[k][j];
-            }
+    int n = a.size;
+    this->size = n;
+    this->g.resize(n);
+    if (sparseProductPays(a.g, b.g)) {
+        SparseMatrix product = SparseMatrix(a) * SparseMatrix(b);
+        for (int i = 0; i < n; ++i) {
+            this->g[i].assign(n, 0);
+            for (long long e = product.rowBegin(i); e < product.rowEnd(i); ++e) this->g[i][product.column(e)] = product.value(e);
         }
+        return;
+    }
+    int crossover = strassenCrossover.load(std::memory_order_relaxed);
+    if (n > crossover) {
+        strassenProduct(a.g, b.g, crossover, this->g);
+        return;
     }
 
-    return result;
+    for (std::vector<int>& row : this->g) row.assign(n, Semiring::PlusTimes::zero);
+    tiledProduct(n,
+                 [&a](int i) { return a.g[i].data(); },
+                 [&b](int k) { return b.g[k].data(); },
+                 [this](int i) { return this->g[i].data(); },
+                 Semiring::PlusTimes(), Semiring::PlusTimes::zero);
 }
 
 /**
@@ -388,3 +771,183 @@ int Graph::countEdges(const std::vector<std::vector<int>>& matrix) const {
     }
     return count;
 }
+
+/**
+ * @brief Multiplies two graphs over a semiring.
+ *
+ * Runs the shared tiled kernel directly over the rows of both graphs.
+ * @param other The graph to multiply by.
+ * @return The result of the multiplication.
+ * @throws std::invalid_argument if the graphs are not of the same size.
+ */
+template <typename S>
+Graph Graph::multiply(const Graph& other) const {
+    if (this->size != other.size) {
+        throw std::invalid_argument("Matrix multiplication requires matrices of the same size.");
+    }
+
+    int n = this->size;
+    Graph result;
+    result.size = n;
+    result.g.assign(n, std::vector<int>(n, S::zero));
+
+    tiledProduct(n,
+                 [this](int i) { return this->g[i].data(); },
+                 [&other](int k) { return other.g[k].data(); },
+                 [&result](int i) { return result.g[i].data(); },
+                 S(), S::zero);
+
+    return result;
+}
+
+/**
+ * @brief Sets the size above which operator* switches to Strassen-Winograd.
+ * @param n The crossover size (default 4096).
+ * @throws std::invalid_argument if n is not positive.
+ */
+void Graph::setStrassenCrossover(int n) {
+    if (n <= 0) {
+        throw std::invalid_argument("The Strassen crossover must be positive.");
+    }
+    strassenCrossover.store(n, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Gets the size above which operator* switches to Strassen-Winograd.
+ */
+int Graph::getStrassenCrossover() {
+    return strassenCrossover.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Raises the graph to a power (matrix exponentiation).
+ * @param k The exponent; 0 gives the identity matrix.
+ * @return The k-th power of the adjacency matrix.
+ * @throws std::invalid_argument if k is negative.
+ * @throws std::overflow_error if an entry does not fit in an int.
+ */
+Graph Graph::operator^(int k) const {
+    if (k < 0) {
+        throw std::invalid_argument("Graph power requires a non-negative exponent.");
+    }
+
+    std::vector<std::vector<long long>> power = pow(*this, k, Accumulation::Saturating);
+    Graph result;
+    result.size = this->size;
+    result.g.resize(this->size, std::vector<int>(this->size, 0));
+    for (int i = 0; i < this->size; ++i) {
+        for (int j = 0; j < this->size; ++j) {
+            if (power[i][j] > std::numeric_limits<int>::max() || power[i][j] < std::numeric_limits<int>::min()) {
+                throw std::overflow_error("Graph power overflows int; use pow() for 64-bit or modular results.");
+            }
+            result.g[i][j] = static_cast<int>(power[i][j]);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Raises the adjacency matrix to the k-th power with exponentiation by squaring.
+ * @param graph The graph.
+ * @param k The exponent; 0 gives the identity matrix.
+ * @param accumulation How entries are accumulated.
+ * @param modulus The modulus for Accumulation::Modular (odd, greater than 1 and below 2^63).
+ * @return The k-th power as a matrix of 64-bit entries.
+ * @throws std::invalid_argument if the modulus is not valid for Accumulation::Modular.
+ */
+std::vector<std::vector<long long>> pow(const Graph& graph, unsigned long long k,
+                                        Accumulation accumulation, unsigned long long modulus) {
+    const std::vector<std::vector<int>>& g = graph.getMatrix();
+    switch (accumulation) {
+        case Accumulation::Modular:
+            if (modulus < 3 || modulus % 2 == 0 || modulus >= (1ULL << 63)) {
+                throw std::invalid_argument("Modular power requires an odd modulus between 3 and 2^63.");
+            }
+            return matrixPower(g, k, Montgomery(modulus));
+        case Accumulation::Saturating:
+            return matrixPower(g, k, SaturatingInt64());
+        case Accumulation::Int64:
+        default:
+            return matrixPower(g, k, WrappingInt64());
+    }
+}
+
+/**
+ * @brief Multiplies the adjacency matrix by a vector (y = A x).
+ * @param x The vector, of one entry per vertex.
+ * @return The product.
+ * @throws std::invalid_argument if the vector size does not match the graph size.
+ */
+template <typename T>
+std::vector<T> Graph::operator*(const std::vector<T>& x) const {
+    std::vector<T> y;
+    this->multiplyVector(x, y, false);
+    return y;
+}
+
+/**
+ * @brief Multiplies the transposed adjacency matrix by a vector (y = A^T x).
+ * @param x The vector, of one entry per vertex.
+ * @return The product.
+ * @throws std::invalid_argument if the vector size does not match the graph size.
+ */
+template <typename T>
+std::vector<T> Graph::transposedTimes(const std::vector<T>& x) const {
+    std::vector<T> y;
+    this->multiplyVector(x, y, true);
+    return y;
+}
+
+/**
+ * @brief Writes A x (or A^T x) into an existing vector, for iterative solvers.
+ * @param x The vector, of one entry per vertex.
+ * @param y Receives the product; must not be x.
+ * @param transposed Multiplies by A^T instead of A.
+ * @throws std::invalid_argument if the vector size does not match the graph size or y is x.
+ */
+template <typename T>
+void Graph::multiplyVector(const std::vector<T>& x, std::vector<T>& y, bool transposed) const {
+    if (static_cast<int>(x.size()) != this->size) {
+        throw std::invalid_argument("Vector size must match the graph size.");
+    }
+    if (&x == &y) {
+        throw std::invalid_argument("The output vector must not be the input vector.");
+    }
+
+    int n = this->size;
+    y.resize(n);
+    int grain = std::max(1, 65536 / std::max(n, 1));
+    if (!transposed) {
+        Parallel::forRange(0, n, grain, [&](int lo, int hi) {
+            for (int i = lo; i < hi; ++i) y[i] = dotRow(this->g[i].data(), x.data(), n);
+        });
+        return;
+    }
+
+    // A^T x = sum of x[i] * row i; each thread owns a range of columns
+    typedef typename Semiring::Wrapping<T>::type U;
+    Parallel::forRange(0, n, grain, [&](int lo, int hi) {
+        std::fill(y.begin() + lo, y.begin() + hi, T(0));
+        for (int i = 0; i < n; ++i) {
+            if (x[i] == T(0)) continue;
+            U xi = static_cast<U>(x[i]);
+            const int* a = this->g[i].data();
+            for (int j = lo; j < hi; ++j) y[j] = static_cast<T>(static_cast<U>(y[j]) + static_cast<U>(a[j]) * xi);
+        }
+    });
+}
+
+template std::vector<int> Graph::operator*(const std::vector<int>& x) const;
+template std::vector<long long> Graph::operator*(const std::vector<long long>& x) const;
+template std::vector<double> Graph::operator*(const std::vector<double>& x) const;
+template std::vector<int> Graph::transposedTimes(const std::vector<int>& x) const;
+template std::vector<long long> Graph::transposedTimes(const std::vector<long long>& x) const;
+template std::vector<double> Graph::transposedTimes(const std::vector<double>& x) const;
+template void Graph::multiplyVector(const std::vector<int>& x, std::vector<int>& y, bool transposed) const;
+template void Graph::multiplyVector(const std::vector<long long>& x, std::vector<long long>& y, bool transposed) const;
+template void Graph::multiplyVector(const std::vector<double>& x, std::vector<double>& y, bool transposed) const;
+
+template Graph Graph::multiply<Semiring::PlusTimes>(const Graph& other) const;
+template Graph Graph::multiply<Semiring::MinPlus>(const Graph& other) const;
+template Graph Graph::multiply<Semiring::MaxMin>(const Graph& other) const;
+template Graph Graph::multiply<Semiring::OrAnd>(const Graph& other) const;
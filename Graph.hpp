@@ -7,12 +7,101 @@
 #define GRAPH_HPP
 
 #include <vector>
+#include <atomic>
 #include <stdexcept>
+#include <limits>
+#include <string>
+
+/**
+ * @brief Semirings for Graph::multiply.
+ *
+ * Each semiring gives its addition, its multiplication, the identity of addition
+ * ("zero", the value of a missing edge, which multiplication must annihilate) and the
+ * identity of multiplication ("one").
+ */
+namespace Semiring {
+    /**
+     * @brief Ordinary (+, *) arithmetic; counts walks. Missing edges are 0.
+     *
+     * Computed on unsigned ints, so overflow wraps modulo 2^32 instead of being undefined.
+     */
+    struct PlusTimes {
+        static constexpr int zero = 0;
+        static constexpr int one = 1;
+        static int add(int a, int b) {
+            return static_cast<int>(static_cast<unsigned int>(a) + static_cast<unsigned int>(b));
+        }
+        static int multiply(int a, int b) {
+            return static_cast<int>(static_cast<unsigned int>(a) * static_cast<unsigned int>(b));
+        }
+    };
+
+    /**
+     * @brief Tropical (min, +); squaring gives shortest distances. Missing edges are INT_MAX,
+     * so 0 is a real zero-weight edge.
+     *
+     * Sums are taken in long long and saturate: at zero (no path) above, at INT_MIN below.
+     */
+    struct MinPlus {
+        static constexpr int zero = std::numeric_limits<int>::max();
+        static constexpr int one = 0;
+        static int add(int a, int b) { return a < b ? a : b; }
+        static int multiply(int a, int b) {
+            if (a == zero || b == zero) return zero;
+            long long sum = static_cast<long long>(a) + b;
+            if (sum >= zero) return zero;
+            if (sum < std::numeric_limits<int>::min()) return std::numeric_limits<int>::min();
+            return static_cast<int>(sum);
+        }
+    };
+
+    /**
+     * @brief Bottleneck (max, min); gives the widest-path capacity. Missing edges are INT_MIN.
+     */
+    struct MaxMin {
+        static constexpr int zero = std::numeric_limits<int>::min();
+        static constexpr int one = std::numeric_limits<int>::max();
+        static int add(int a, int b) { return a > b ? a : b; }
+        static int multiply(int a, int b) { return a < b ? a : b; }
+    };
+
+    /**
+     * @brief Boolean (or, and); gives reachability. Any non-zero entry is an edge, results are 0/1.
+     */
+    struct OrAnd {
+        static constexpr int zero = 0;
+        static constexpr int one = 1;
+        static int add(int a, int b) { return (a != 0 || b != 0) ? 1 : 0; }
+        static int multiply(int a, int b) { return (a != 0 && b != 0) ? 1 : 0; }
+    };
+
+    /**
+     * @brief The type a matrix-vector product of T accumulates in.
+     *
+     * Integer products are summed on the matching unsigned type, so overflow wraps like
+     * PlusTimes instead of being undefined; double is summed as it is.
+     */
+    template <typename T>
+    struct Wrapping {
+        typedef T type;
+    };
+
+    template <>
+    struct Wrapping<int> {
+        typedef unsigned int type;
+    };
+
+    template <>
+    struct Wrapping<long long> {
+        typedef unsigned long long type;
+    };
+}
 
 class Graph {
     private:
         std::vector<std::vector<int>> g; ///< Adjacency matrix of the graph.
         int size; ///< Size of the graph (number of vertices).
+        static std::atomic<int> strassenCrossover; ///< Sizes above this use Strassen-Winograd in operator*.
 
     public:
         /**
@@ -35,9 +124,9 @@ class Graph {
 
         /**
          * @brief Gets the adjacency matrix of the graph.
-         * @return The adjacency matrix of the graph.
+         * @return A read-only reference to the adjacency matrix of the graph.
          */
-        std::vector<std::vector<int>> getMatrix() const;
+        const std::vector<std::vector<int>>& getMatrix() const;
 
         
         friend std::ostream& operator<<(std::ostream& os, const Graph& graph);
@@ -176,18 +265,138 @@ class Graph {
 
         /**
          * @brief Multiplies two graphs (matrix multiplication).
+         *
+         * When both operands are sparse enough that a sparse Gustavson product (see
+         * SparseMatrix) does far fewer multiply-adds than the dense kernel, that is used. Otherwise,
+         * above getStrassenCrossover() vertices the product uses Strassen-Winograd recursion
+         * with the tiled kernel at the leaves. The result is the same as the classical product
+         * (arithmetic wraps modulo 2^32 in both, on unsigned ints).
          * @param other The graph to multiply by.
          * @return The result of the multiplication.
          * @throws std::invalid_argument if the graphs are not of the same size.
          */
         Graph operator*(const Graph& other) const;
 
+        /**
+         * @brief Stores the product a * b in this graph, exactly as operator* computes it.
+         *
+         * The rows of this graph are overwritten in place, so repeated products into the
+         * same graph reuse its storage instead of allocating a new matrix each time. This
+         * graph may be a or b (the product then goes through a temporary).
+         * @param a The left factor.
+         * @param b The right factor.
+         * @throws std::invalid_argument if the graphs are not of the same size.
+         */
+        void assignProduct(const Graph& a, const Graph& b);
+
         /**
          * @brief Multiplies this graph by another graph (matrix multiplication).
          * @param other The graph to multiply by.
          * @return A reference to this graph.
          */
         Graph& operator*=(const Graph& other);
+
+        /**
+         * @brief Multiplies two graphs over a semiring.
+         *
+         * Entries equal to Semiring::zero are missing edges. The product runs on the same
+         * blocked, multithreaded kernel as operator*. It is instantiated for the semirings in
+         * the Semiring namespace.
+         * @tparam S The semiring (e.g. Semiring::MinPlus).
+         * @param other The graph to multiply by.
+         * @return The result of the multiplication; cells with no contribution hold S::zero.
+         * @throws std::invalid_argument if the graphs are not of the same size.
+         */
+        template <typename S>
+        Graph multiply(const Graph& other) const;
+
+        /**
+         * @brief Multiplies the adjacency matrix by a vector (y = A x).
+         *
+         * Each row is a dot product with four independent partial sums, so the loop
+         * vectorises; rows are split across threads. Instantiated for int, long long and
+         * double; integer sums wrap (see Semiring::Wrapping).
+         * @param x The vector, of one entry per vertex.
+         * @return The product.
+         * @throws std::invalid_argument if the vector size does not match the graph size.
+         */
+        template <typename T>
+        std::vector<T> operator*(const std::vector<T>& x) const;
+
+        /**
+         * @brief Multiplies the transposed adjacency matrix by a vector (y = A^T x).
+         * @param x The vector, of one entry per vertex.
+         * @return The product.
+         * @throws std::invalid_argument if the vector size does not match the graph size.
+         */
+        template <typename T>
+        std::vector<T> transposedTimes(const std::vector<T>& x) const;
+
+        /**
+         * @brief Writes A x (or A^T x) into an existing vector, for iterative solvers.
+         *
+         * y is resized to the number of vertices, which keeps its storage once it has that
+         * size, so repeated calls do not allocate. A^T x is computed as a sum of scaled
+         * rows, with threads splitting the columns.
+         * @param x The vector, of one entry per vertex.
+         * @param y Receives the product; must not be x.
+         * @param transposed Multiplies by A^T instead of A.
+         * @throws std::invalid_argument if the vector size does not match the graph size or y is x.
+         */
+        template <typename T>
+        void multiplyVector(const std::vector<T>& x, std::vector<T>& y, bool transposed = false) const;
+
+        /**
+         * @brief Raises the graph to a power (matrix exponentiation).
+         *
+         * Computed by repeated squaring with 64-bit saturating accumulation.
+         * @param k The exponent; 0 gives the identity matrix.
+         * @return The k-th power of the adjacency matrix.
+         * @throws std::invalid_argument if k is negative.
+         * @throws std::overflow_error if an entry does not fit in an int.
+         */
+        Graph operator^(int k) const;
+
+        /**
+         * @brief Sets the size above which operator* switches to Strassen-Winograd.
+         *
+         * The setting is shared by all graphs and stored atomically; a product reads it
+         * once when it starts.
+         * @param n The crossover size (default 4096).
+         * @throws std::invalid_argument if n is not positive.
+         */
+        static void setStrassenCrossover(int n);
+
+        /**
+         * @brief Gets the size above which operator* switches to Strassen-Winograd.
+         */
+        static int getStrassenCrossover();
 };
 
+/**
+ * @brief How pow accumulates the entries of the power.
+ */
+enum class Accumulation {
+    Int64, ///< 64-bit two's complement; wraps around on overflow.
+    Modular, ///< Modulo an odd modulus, using Montgomery multiplication; entries are in [0, modulus).
+    Saturating ///< 64-bit, clamped to the range of long long on overflow.
+};
+
+/**
+ * @brief Raises the adjacency matrix to the k-th power with exponentiation by squaring.
+ *
+ * Uses about log2(k) + popcount(k) products on the same tiled, multithreaded kernel as
+ * operator*, and reuses three n*n buffers throughout. With an adjacency matrix of 0/1
+ * entries, entry (i, j) counts the walks of length k from i to j.
+ * @param graph The graph.
+ * @param k The exponent; 0 gives the identity matrix.
+ * @param accumulation How entries are accumulated.
+ * @param modulus The modulus for Accumulation::Modular (odd, greater than 1 and below 2^63).
+ * @return The k-th power as a matrix of 64-bit entries.
+ * @throws std::invalid_argument if the modulus is not valid for Accumulation::Modular.
+ */
+std::vector<std::vector<long long>> pow(const Graph& graph, unsigned long long k,
+                                        Accumulation accumulation = Accumulation::Int64,
+                                        unsigned long long modulus = 0);
+
 #endif // GRAPH_HPP
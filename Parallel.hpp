@@ -0,0 +1,104 @@
+/*
+ * Author: yehonatan768@gmail.com
+ * ID: 213637424
+ */
+
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace Parallel {
+
+    /**
+     * @brief The thread count set by setThreadCount, 0 for the hardware default.
+     */
+    inline int& threadOverride() {
+        static int count = 0;
+        return count;
+    }
+
+    /**
+     * @brief Overrides the number of worker threads; 0 restores the hardware default.
+     *
+     * Not synchronised: call it only while no parallel work is running.
+     */
+    inline void setThreadCount(int count) {
+        threadOverride() = std::max(0, count);
+    }
+
+    /**
+     * @brief Returns the number of worker threads to use (at least 1).
+     */
+    inline int threadCount() {
+        if (threadOverride() > 0) return threadOverride();
+        unsigned int hw = std::thread::hardware_concurrency();
+        return hw == 0 ? 1 : static_cast<int>(hw);
+    }
+
+    /**
+     * @brief Splits [begin, end) into contiguous chunks and runs body(lo, hi) on each chunk.
+     *
+     * Ranges shorter than two grains run inline on the calling thread, so small inputs
+     * pay no thread start-up cost. The call returns once every chunk is done.
+     *
+     * @param begin The first index.
+     * @param end One past the last index.
+     * @param grain The smallest chunk worth handing to its own thread.
+     * @param body A callable taking (int lo, int hi).
+     */
+    template <typename Body>
+    void forRange(int begin, int end, int grain, const Body& body) {
+        int total = end - begin;
+        if (total <= 0) return;
+        int workers = std::min(threadCount(), total / std::max(grain, 1));
+        if (workers <= 1) {
+            body(begin, end);
+            return;
+        }
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+        int chunk = (total + workers - 1) / workers;
+        for (int lo = begin + chunk; lo < end; lo += chunk) {
+            int hi = std::min(lo + chunk, end);
+            threads.emplace_back([&body, lo, hi]() { body(lo, hi); });
+        }
+        body(begin, std::min(begin + chunk, end));
+        for (std::thread& t : threads) t.join();
+    }
+
+    /**
+     * @brief Runs body(worker, lo, hi) on at most threadCount() chunks of [begin, end).
+     *
+     * Unlike forRange, the body also gets the index of its worker so it can write into
+     * a per-thread accumulator without locking.
+     *
+     * @param begin The first index.
+     * @param end One past the last index.
+     * @param grain The smallest chunk worth handing to its own thread.
+     * @param body A callable taking (int worker, int lo, int hi).
+     * @return int The number of chunks that ran; worker indices are below this value. It can
+     *         be less than threadCount() when the range does not fill every chunk.
+     */
+    template <typename Body>
+    int forWorkers(int begin, int end, int grain, const Body& body) {
+        int total = end - begin;
+        if (total <= 0) return 0;
+        int workers = std::max(1, std::min(threadCount(), total / std::max(grain, 1)));
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+        int chunk = (total + workers - 1) / workers;
+        int worker = 1;
+        for (int lo = begin + chunk; lo < end; lo += chunk, ++worker) {
+            int hi = std::min(lo + chunk, end);
+            threads.emplace_back([&body, worker, lo, hi]() { body(worker, lo, hi); });
+        }
+        body(0, begin, std::min(begin + chunk, end));
+        for (std::thread& t : threads) t.join();
+        return worker;
+    }
+}
+
+#endif // PARALLEL_HPP
@@ -0,0 +1,189 @@
+/*
+ * Author: yehonatan768@gmail.com
+ * ID: 213637424
+ */
+
+#include "ProductChain.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+    /**
+     * @brief The chosen split of every interval of the chain.
+     */
+    struct Plan {
+        std::vector<std::vector<int>> split; ///< split[i][j]: last factor of the left part of [i, j].
+    };
+
+    /**
+     * @brief Estimated cost of X * Y for n x n operands of the given densities.
+     *
+     * Mirrors Graph::operator*: the sparse product costs about n^3 dX dY multiply-adds
+     * (with a margin for the accumulator), the dense kernel about n^3 dX since it skips
+     * the zeros of X. Both first read their operands, n^2 each.
+     */
+    double productCost(double n, double dx, double dy) {
+        double sparse = 8 * n * n * n * dx * dy;
+        double dense = n * n * n * dx;
+        return 2 * n * n + std::min(sparse, dense);
+    }
+
+    /**
+     * @brief Expected density of X * Y if the non-zeros are spread uniformly.
+     */
+    double productDensity(double n, double dx, double dy) {
+        double p = dx * dy;
+        if (p >= 1) return 1;
+        return 1 - std::exp(n * std::log1p(-p));
+    }
+
+    /**
+     * @brief Matrix-chain dynamic program over the factor densities.
+     */
+    Plan planChain(const std::vector<const Graph*>& factors) {
+        int m = factors.size();
+        int n = factors[0]->getMatrix().size();
+        double cells = std::max(1.0, static_cast<double>(n) * n);
+
+        std::vector<std::vector<double>> cost(m, std::vector<double>(m, 0));
+        std::vector<std::vector<double>> density(m, std::vector<double>(m, 0));
+        Plan plan;
+        plan.split.assign(m, std::vector<int>(m, -1));
+        for (int i = 0; i < m; ++i) {
+            double nonZeros = 0;
+            for (const std::vector<int>& row : factors[i]->getMatrix()) {
+                nonZeros += row.size() - std::count(row.begin(), row.end(), 0);
+            }
+            density[i][i] = nonZeros / cells;
+        }
+
+        for (int length = 2; length <= m; ++length) {
+            for (int i = 0; i + length - 1 < m; ++i) {
+                int j = i + length - 1;
+                cost[i][j] = std::numeric_limits<double>::infinity();
+                for (int k = i; k < j; ++k) {
+                    double c = cost[i][k] + cost[k + 1][j] + productCost(n, density[i][k], density[k + 1][j]);
+                    if (c < cost[i][j]) {
+                        cost[i][j] = c;
+                        plan.split[i][j] = k;
+                        density[i][j] = productDensity(n, density[i][k], density[k + 1][j]);
+                    }
+                }
+            }
+        }
+        return plan;
+    }
+
+    /**
+     * @brief Writes the parenthesisation of [i, j] into out.
+     */
+    void describe(const Plan& plan, int i, int j, std::string& out) {
+        if (i == j) {
+            out += std::to_string(i);
+            return;
+        }
+        int k = plan.split[i][j];
+        out += "(";
+        describe(plan, i, k, out);
+        out += " * ";
+        describe(plan, k + 1, j, out);
+        out += ")";
+    }
+
+    /**
+     * @brief Multiplies out a plan, keeping consumed intermediates as scratch matrices.
+     *
+     * Single factors are multiplied straight from the caller's graphs. Every intermediate
+     * is written with Graph::assignProduct into a matrix taken from the spares, and goes
+     * back to them once it has been consumed, so a chain allocates at most a few matrices
+     * whatever its length.
+     */
+    struct ChainEvaluator {
+        const std::vector<const Graph*>& factors;
+        const Plan& plan;
+        std::vector<Graph> spare; ///< Consumed intermediates whose storage is reused.
+
+        ChainEvaluator(const std::vector<const Graph*>& factors, const Plan& plan) : factors(factors), plan(plan) {}
+
+        Graph take() {
+            if (this->spare.empty()) return Graph();
+            Graph scratch = std::move(this->spare.back());
+            this->spare.pop_back();
+            return scratch;
+        }
+
+        /**
+         * @brief Multiplies out [i, j], i < j, in the planned order.
+         */
+        Graph run(int i, int j) {
+            int k = this->plan.split[i][j];
+            Graph left, right;
+            if (i != k) left = run(i, k);
+            if (k + 1 != j) right = run(k + 1, j);
+            Graph out = take();
+            out.assignProduct(i == k ? *this->factors[i] : left, k + 1 == j ? *this->factors[j] : right);
+            if (i != k) this->spare.push_back(std::move(left));
+            if (k + 1 != j) this->spare.push_back(std::move(right));
+            return out;
+        }
+    };
+}
+
+/**
+ * @brief Starts a chain with a single factor.
+ * @param first The leftmost factor.
+ */
+ProductChain::ProductChain(const Graph& first) : factors(1, &first) {}
+
+/**
+ * @brief Appends a factor on the right.
+ * @param next The factor to append.
+ * @return A reference to this chain.
+ * @throws std::invalid_argument if the factor is not of the same size as the chain.
+ */
+ProductChain& ProductChain::operator*(const Graph& next) {
+    if (next.getMatrix().size() != this->factors[0]->getMatrix().size()) {
+        throw std::invalid_argument("Matrix multiplication requires matrices of the same size.");
+    }
+    this->factors.push_back(&next);
+    return *this;
+}
+
+/**
+ * @brief Gets the number of factors in the chain.
+ */
+int ProductChain::length() const {
+    return this->factors.size();
+}
+
+/**
+ * @brief Describes the multiplication order the planner picks, e.g. "(0 * (1 * 2))".
+ * @return The planned parenthesisation, with factors numbered from 0.
+ */
+std::string ProductChain::plan() const {
+    std::string ans;
+    describe(planChain(this->factors), 0, this->length() - 1, ans);
+    return ans;
+}
+
+/**
+ * @brief Multiplies the chain out in the planned order.
+ * @return The product of all factors.
+ */
+Graph ProductChain::evaluate() const {
+    if (this->length() == 1) return *this->factors[0];
+    Plan plan = planChain(this->factors);
+    ChainEvaluator evaluator(this->factors, plan);
+    return evaluator.run(0, this->length() - 1);
+}
+
+/**
+ * @brief Evaluates the chain (see evaluate()).
+ */
+ProductChain::operator Graph() const {
+    return this->evaluate();
+}
@@ -0,0 +1,69 @@
+/*
+ * Author: yehonatan768@gmail.com
+ * ID: 213637424
+ */
+
+#ifndef PRODUCTCHAIN_HPP
+#define PRODUCTCHAIN_HPP
+
+#include <string>
+#include <vector>
+#include "Graph.hpp"
+
+/**
+ * @brief A lazily evaluated product of several graphs, multiplied in the cheapest order.
+ *
+ * Build it with chained operator*, e.g. `Graph r = ProductChain(a) * b * c * d;`. Nothing
+ * is multiplied until the chain is converted to a Graph (or evaluate() is called). Then a
+ * dynamic program over the split points picks the parenthesisation with the lowest
+ * estimated cost, using the non-zero count of every factor and the same sparse/dense
+ * cost model as Graph::operator*. Intermediates are never copied: each is computed with
+ * Graph::assignProduct into the storage of one already consumed, so a long chain reuses
+ * a few scratch matrices instead of allocating one per step.
+ *
+ * The chain keeps references to its factors, so they must outlive it; using it within
+ * a single expression, as above, is always safe.
+ */
+class ProductChain {
+    private:
+        std::vector<const Graph*> factors; ///< The factors, left to right.
+
+    public:
+        /**
+         * @brief Starts a chain with a single factor.
+         * @param first The leftmost factor.
+         */
+        explicit ProductChain(const Graph& first);
+
+        /**
+         * @brief Appends a factor on the right.
+         * @param next The factor to append.
+         * @return A reference to this chain.
+         * @throws std::invalid_argument if the factor is not of the same size as the chain.
+         */
+        ProductChain& operator*(const Graph& next);
+
+        /**
+         * @brief Gets the number of factors in the chain.
+         */
+        int length() const;
+
+        /**
+         * @brief Describes the multiplication order the planner picks, e.g. "(0 * (1 * 2))".
+         * @return The planned parenthesisation, with factors numbered from 0.
+         */
+        std::string plan() const;
+
+        /**
+         * @brief Multiplies the chain out in the planned order.
+         * @return The product of all factors.
+         */
+        Graph evaluate() const;
+
+        /**
+         * @brief Evaluates the chain (see evaluate()).
+         */
+        operator Graph() const;
+};
+
+#endif // PRODUCTCHAIN_HPP
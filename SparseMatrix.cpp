@@ -0,0 +1,414 @@
+/*
+ * Author: yehonatan768@gmail.com
+ * ID: 213637424
+ */
+
+#include "SparseMatrix.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Compresses the adjacency matrix of a graph.
+ * @param graph The graph to compress.
+ */
+SparseMatrix::SparseMatrix(const Graph& graph) : size(static_cast<int>(graph.getMatrix().size())) {
+    const std::vector<std::vector<int>>& g = graph.getMatrix();
+    this->rowStart.assign(this->size + 1, 0);
+    for (int i = 0; i < this->size; ++i) {
+        for (int j = 0; j < this->size; ++j) {
+            if (g[i][j] == 0) continue;
+            this->columns.push_back(j);
+            this->values.push_back(g[i][j]);
+        }
+        this->rowStart[i + 1] = static_cast<long long>(this->columns.size());
+    }
+}
+
+/**
+ * @brief Builds an n x n matrix from a list of entries, without a dense matrix.
+ * @param n The number of rows and columns.
+ * @param entries The entries.
+ * @throws std::invalid_argument if n is negative or an entry is out of range.
+ */
+SparseMatrix::SparseMatrix(int n, std::vector<Entry> entries) : size(n) {
+    if (n < 0) {
+        throw std::invalid_argument("Invalid matrix: The size must not be negative.");
+    }
+    for (const Entry& e : entries) {
+        if (e.row < 0 || e.row >= n || e.column < 0 || e.column >= n) {
+            throw std::invalid_argument("Invalid matrix: An entry is out of range.");
+        }
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry& x, const Entry& y) {
+        return x.row != y.row ? x.row < y.row : x.column < y.column;
+    });
+
+    this->rowStart.assign(n + 1, 0);
+    size_t e = 0;
+    for (int i = 0; i < n; ++i) {
+        while (e < entries.size() && entries[e].row == i) {
+            int column = entries[e].column;
+            unsigned int sum = 0;
+            for (; e < entries.size() && entries[e].row == i && entries[e].column == column; ++e) {
+                sum += static_cast<unsigned int>(entries[e].value);
+            }
+            if (sum == 0) continue;
+            this->columns.push_back(column);
+            this->values.push_back(static_cast<int>(sum));
+        }
+        this->rowStart[i + 1] = static_cast<long long>(this->columns.size());
+    }
+}
+
+/**
+ * @brief Expands the matrix back into a dense Graph.
+ */
+Graph SparseMatrix::toGraph() const {
+    Graph graph;
+    if (this->size == 0) return graph;
+
+    std::vector<std::vector<int>> matrix(this->size, std::vector<int>(this->size, 0));
+    for (int i = 0; i < this->size; ++i) {
+        for (long long e = this->rowStart[i]; e < this->rowStart[i + 1]; ++e) {
+            matrix[i][this->columns[e]] = this->values[e];
+        }
+    }
+    graph.setMatrix(matrix);
+    return graph;
+}
+
+/**
+ * @brief Sparse x sparse product (SpGEMM) by Gustavson's row-by-row algorithm.
+ *
+ * Each worker keeps a dense accumulator of n values plus a marker per column, so the
+ * accumulator is never cleared; only the columns touched by a row are visited, sorted
+ * and emitted. Workers write their rows into private buffers which are then
+ * concatenated in row order.
+ * @param other The matrix to multiply by.
+ * @return The sparse product.
+ * @throws std::invalid_argument if the matrices are not of the same size.
+ */
+SparseMatrix SparseMatrix::operator*(const SparseMatrix& other) const {
+    if (this->size != other.size) {
+        throw std::invalid_argument("Matrix multiplication requires matrices of the same size.");
+    }
+
+    int n = this->size;
+    int workers = Parallel::threadCount();
+    std::vector<std::vector<int>> workerColumns(workers), workerValues(workers);
+    std::vector<long long> rowCount(n, 0);
+
+    Parallel::forWorkers(0, n, 256, [&](int worker, int lo, int hi) {
+        std::vector<unsigned int> accumulator(n, 0);
+        std::vector<int> marker(n, -1);
+        std::vector<int> touched;
+        std::vector<int>& outColumns = workerColumns[worker];
+        std::vector<int>& outValues = workerValues[worker];
+        for (int i = lo; i < hi; ++i) {
+            touched.clear();
+            for (long long e = this->rowStart[i]; e < this->rowStart[i + 1]; ++e) {
+                unsigned int a = static_cast<unsigned int>(this->values[e]);
+                int k = this->columns[e];
+                for (long long f = other.rowStart[k]; f < other.rowStart[k + 1]; ++f) {
+                    int j = other.columns[f];
+                    unsigned int product = a * static_cast<unsigned int>(other.values[f]);
+                    if (marker[j] != i) {
+                        marker[j] = i;
+                        accumulator[j] = product;
+                        touched.push_back(j);
+                    } else {
+                        accumulator[j] += product;
+                    }
+                }
+            }
+            std::sort(touched.begin(), touched.end());
+            long long before = static_cast<long long>(outColumns.size());
+            for (int j : touched) {
+                if (accumulator[j] == 0) continue;
+                outColumns.push_back(j);
+                outValues.push_back(static_cast<int>(accumulator[j]));
+            }
+            rowCount[i] = static_cast<long long>(outColumns.size()) - before;
+        }
+    });
+
+    return assemble(n, rowCount, workerColumns, workerValues);
+}
+
+/**
+ * @brief Adds two matrices by merging their sorted rows; cancelled entries are dropped.
+ * @param other The matrix to add.
+ * @return The sum, in O(nnz) work.
+ * @throws std::invalid_argument if the matrices are not of the same size.
+ */
+SparseMatrix SparseMatrix::operator+(const SparseMatrix& other) const {
+    if (this->size != other.size) {
+        throw std::invalid_argument("Graphs must be of the same size to add.");
+    }
+    return merge(*this, other, [](unsigned int x, unsigned int y) { return x + y; });
+}
+
+/**
+ * @brief Subtracts a matrix by merging sorted rows; cancelled entries are dropped.
+ * @param other The matrix to subtract.
+ * @return The difference, in O(nnz) work.
+ * @throws std::invalid_argument if the matrices are not of the same size.
+ */
+SparseMatrix SparseMatrix::operator-(const SparseMatrix& other) const {
+    if (this->size != other.size) {
+        throw std::invalid_argument("Graphs must be of the same size to subtract.");
+    }
+    return merge(*this, other, [](unsigned int x, unsigned int y) { return x - y; });
+}
+
+/**
+ * @brief Compares two matrices with the same rules as Graph::operator>.
+ * @param other The matrix to compare with.
+ * @return True if this matrix is greater than the other, false otherwise.
+ * @throws std::invalid_argument if the matrices are not of the same size.
+ */
+bool SparseMatrix::operator>(const SparseMatrix& other) const {
+    if (this->size != other.size) {
+        throw std::invalid_argument("Graphs must be of the same size to compare.");
+    }
+
+    bool thisContainedInOther = true;
+    bool otherContainedInThis = true;
+    bool differs = false;
+    bool lexicographicallyLess = false;
+    for (int i = 0; i < this->size; ++i) {
+        mergeRow(*this, other, i, [&](int, int x, int y) {
+            if (x > y) otherContainedInThis = false;
+            if (x < y) thisContainedInOther = false;
+            if (x != y && !differs) {
+                differs = true;
+                lexicographicallyLess = x < y;
+            }
+        });
+    }
+
+    if (otherContainedInThis && !thisContainedInOther) {
+        return false;
+    } else if (thisContainedInOther && !otherContainedInThis) {
+        return true;
+    }
+
+    long long thisEdges = std::count(this->values.begin(), this->values.end(), 1);
+    long long otherEdges = std::count(other.values.begin(), other.values.end(), 1);
+    if (thisEdges != otherEdges) {
+        return otherEdges > thisEdges;
+    }
+    return differs && lexicographicallyLess;
+}
+
+/**
+ * @brief Compares two matrices to determine if this matrix is less than the other.
+ */
+bool SparseMatrix::operator<(const SparseMatrix& other) const {
+    return other > *this;
+}
+
+/**
+ * @brief Builds a matrix from rows produced by parallel workers.
+ */
+SparseMatrix SparseMatrix::assemble(int n, const std::vector<long long>& rowCount,
+                                    std::vector<std::vector<int>>& workerColumns,
+                                    std::vector<std::vector<int>>& workerValues) {
+    SparseMatrix result;
+    result.size = n;
+    result.rowStart.assign(n + 1, 0);
+    for (int i = 0; i < n; ++i) result.rowStart[i + 1] = result.rowStart[i] + rowCount[i];
+    result.columns.reserve(result.rowStart[n]);
+    result.values.reserve(result.rowStart[n]);
+    // workers own increasing row ranges, so concatenating their buffers keeps row order
+    for (size_t w = 0; w < workerColumns.size(); ++w) {
+        result.columns.insert(result.columns.end(), workerColumns[w].begin(), workerColumns[w].end());
+        result.values.insert(result.values.end(), workerValues[w].begin(), workerValues[w].end());
+        std::vector<int>().swap(workerColumns[w]);
+        std::vector<int>().swap(workerValues[w]);
+    }
+    return result;
+}
+
+/**
+ * @brief Walks row i of a and b together in column order.
+ */
+template <typename Visit>
+void SparseMatrix::mergeRow(const SparseMatrix& a, const SparseMatrix& b, int i, const Visit& visit) {
+    long long e = a.rowStart[i], f = b.rowStart[i];
+    long long eEnd = a.rowStart[i + 1], fEnd = b.rowStart[i + 1];
+    while (e < eEnd || f < fEnd) {
+        if (f == fEnd || (e < eEnd && a.columns[e] < b.columns[f])) {
+            visit(a.columns[e], a.values[e], 0);
+            ++e;
+        } else if (e == eEnd || b.columns[f] < a.columns[e]) {
+            visit(b.columns[f], 0, b.values[f]);
+            ++f;
+        } else {
+            visit(a.columns[e], a.values[e], b.values[f]);
+            ++e;
+            ++f;
+        }
+    }
+}
+
+/**
+ * @brief Merges the sorted rows of a and b, combining values with op(x, y).
+ */
+template <typename Op>
+SparseMatrix SparseMatrix::merge(const SparseMatrix& a, const SparseMatrix& b, const Op& op) {
+    int n = a.size;
+    int workers = Parallel::threadCount();
+    std::vector<std::vector<int>> workerColumns(workers), workerValues(workers);
+    std::vector<long long> rowCount(n, 0);
+
+    Parallel::forWorkers(0, n, 4096, [&](int worker, int lo, int hi) {
+        std::vector<int>& outColumns = workerColumns[worker];
+        std::vector<int>& outValues = workerValues[worker];
+        for (int i = lo; i < hi; ++i) {
+            long long before = static_cast<long long>(outColumns.size());
+            mergeRow(a, b, i, [&](int column, int x, int y) {
+                unsigned int value = op(static_cast<unsigned int>(x), static_cast<unsigned int>(y));
+                if (value == 0) return;
+                outColumns.push_back(column);
+                outValues.push_back(static_cast<int>(value));
+            });
+            rowCount[i] = static_cast<long long>(outColumns.size()) - before;
+        }
+    });
+
+    return assemble(n, rowCount, workerColumns, workerValues);
+}
+
+/**
+ * @brief Returns the transpose, built in O(n + nnz) by counting sort.
+ */
+SparseMatrix SparseMatrix::transpose() const {
+    int n = this->size;
+    SparseMatrix result;
+    result.size = n;
+    result.rowStart.assign(n + 1, 0);
+    for (int column : this->columns) ++result.rowStart[column + 1];
+    for (int j = 0; j < n; ++j) result.rowStart[j + 1] += result.rowStart[j];
+
+    result.columns.resize(this->columns.size());
+    result.values.resize(this->values.size());
+    std::vector<long long> next(result.rowStart.begin(), result.rowStart.end() - 1);
+    // rows are visited in order, so every transposed row comes out sorted
+    for (int i = 0; i < n; ++i) {
+        for (long long e = this->rowStart[i]; e < this->rowStart[i + 1]; ++e) {
+            long long slot = next[this->columns[e]]++;
+            result.columns[slot] = i;
+            result.values[slot] = this->values[e];
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Sparse matrix-vector product (SpMV, y = A x), parallel by row.
+ * @param x The vector, of one entry per row.
+ * @return The product.
+ * @throws std::invalid_argument if the vector size does not match the matrix size.
+ */
+template <typename T>
+std::vector<T> SparseMatrix::operator*(const std::vector<T>& x) const {
+    std::vector<T> y;
+    this->multiplyVector(x, y, false);
+    return y;
+}
+
+/**
+ * @brief Sparse transposed product (y = A^T x).
+ * @param x The vector, of one entry per row.
+ * @return The product.
+ * @throws std::invalid_argument if the vector size does not match the matrix size.
+ */
+template <typename T>
+std::vector<T> SparseMatrix::transposedTimes(const std::vector<T>& x) const {
+    std::vector<T> y;
+    this->multiplyVector(x, y, true);
+    return y;
+}
+
+/**
+ * @brief Writes A x (or A^T x) into an existing vector, for iterative solvers.
+ * @param x The vector, of one entry per row.
+ * @param y Receives the product; must not be x.
+ * @param transposed Multiplies by A^T instead of A.
+ * @throws std::invalid_argument if the vector size does not match the matrix size or y is x.
+ */
+template <typename T>
+void SparseMatrix::multiplyVector(const std::vector<T>& x, std::vector<T>& y, bool transposed) const {
+    if (static_cast<int>(x.size()) != this->size) {
+        throw std::invalid_argument("Vector size must match the graph size.");
+    }
+    if (&x == &y) {
+        throw std::invalid_argument("The output vector must not be the input vector.");
+    }
+
+    typedef typename Semiring::Wrapping<T>::type U;
+    int n = this->size;
+    y.resize(n);
+    if (!transposed) {
+        Parallel::forRange(0, n, 2048, [&](int lo, int hi) {
+            for (int i = lo; i < hi; ++i) {
+                U sum = 0;
+                for (long long e = this->rowStart[i]; e < this->rowStart[i + 1]; ++e) {
+                    sum += static_cast<U>(this->values[e]) * static_cast<U>(x[this->columns[e]]);
+                }
+                y[i] = static_cast<T>(sum);
+            }
+        });
+        return;
+    }
+
+    // scatter every row into a per-worker partial result, then add them up by column
+    std::fill(y.begin(), y.end(), T(0));
+    int workers = Parallel::threadCount();
+    std::vector<std::vector<T>> partial(workers);
+    Parallel::forWorkers(0, n, 2048, [&](int worker, int lo, int hi) {
+        std::vector<T>& out = worker == 0 ? y : partial[worker];
+        if (worker != 0) out.assign(n, T(0));
+        for (int i = lo; i < hi; ++i) {
+            if (x[i] == T(0)) continue;
+            U xi = static_cast<U>(x[i]);
+            for (long long e = this->rowStart[i]; e < this->rowStart[i + 1]; ++e) {
+                T& cell = out[this->columns[e]];
+                cell = static_cast<T>(static_cast<U>(cell) + static_cast<U>(this->values[e]) * xi);
+            }
+        }
+    });
+    Parallel::forRange(0, n, 8192, [&](int lo, int hi) {
+        for (int w = 1; w < workers; ++w) {
+            if (partial[w].empty()) continue;
+            for (int j = lo; j < hi; ++j) y[j] = static_cast<T>(static_cast<U>(y[j]) + static_cast<U>(partial[w][j]));
+        }
+    });
+}
+
+template std::vector<int> SparseMatrix::operator*(const std::vector<int>& x) const;
+template std::vector<long long> SparseMatrix::operator*(const std::vector<long long>& x) const;
+template std::vector<double> SparseMatrix::operator*(const std::vector<double>& x) const;
+template std::vector<int> SparseMatrix::transposedTimes(const std::vector<int>& x) const;
+template std::vector<long long> SparseMatrix::transposedTimes(const std::vector<long long>& x) const;
+template std::vector<double> SparseMatrix::transposedTimes(const std::vector<double>& x) const;
+template void SparseMatrix::multiplyVector(const std::vector<int>& x, std::vector<int>& y, bool transposed) const;
+template void SparseMatrix::multiplyVector(const std::vector<long long>& x, std::vector<long long>& y, bool transposed) const;
+template void SparseMatrix::multiplyVector(const std::vector<double>& x, std::vector<double>& y, bool transposed) const;
+
+/**
+ * @brief Compares two matrices for equality.
+ */
+bool SparseMatrix::operator==(const SparseMatrix& other) const {
+    return this->size == other.size && this->rowStart == other.rowStart
+        && this->columns == other.columns && this->values == other.values;
+}
+
+/**
+ * @brief Compares two matrices for inequality.
+ */
+bool SparseMatrix::operator!=(const SparseMatrix& other) const {
+    return !(*this == other);
+}
@@ -0,0 +1,215 @@
+/*
+ * Author: yehonatan768@gmail.com
+ * ID: 213637424
+ */
+
+#ifndef SPARSEMATRIX_HPP
+#define SPARSEMATRIX_HPP
+
+#include <vector>
+#include "Graph.hpp"
+
+/**
+ * @brief A square matrix in compressed sparse row (CSR) form.
+ *
+ * Only non-zero entries are stored, and the columns of each row are kept sorted.
+ */
+class SparseMatrix {
+    private:
+        int size; ///< Number of rows (and columns).
+        std::vector<long long> rowStart; ///< Row i occupies [rowStart[i], rowStart[i + 1]).
+        std::vector<int> columns; ///< Column of every stored entry.
+        std::vector<int> values; ///< Value of every stored entry.
+
+        /**
+         * @brief Builds a matrix from rows produced by parallel workers.
+         *
+         * Worker w produced the rows of the w-th contiguous range, in order; rowCount holds
+         * the number of entries of every row.
+         */
+        static SparseMatrix assemble(int n, const std::vector<long long>& rowCount,
+                                     std::vector<std::vector<int>>& workerColumns,
+                                     std::vector<std::vector<int>>& workerValues);
+
+        /**
+         * @brief Walks row i of a and b together in column order, calling visit(column, x, y)
+         *        for every column stored in either; a missing side contributes 0.
+         *
+         * The one row merge shared by merge and operator>.
+         */
+        template <typename Visit>
+        static void mergeRow(const SparseMatrix& a, const SparseMatrix& b, int i, const Visit& visit);
+
+        /**
+         * @brief Merges the sorted rows of a and b, combining values with op(x, y).
+         *
+         * A column missing from one side contributes 0 there. Results equal to 0 are not
+         * stored. Rows are split across threads.
+         */
+        template <typename Op>
+        static SparseMatrix merge(const SparseMatrix& a, const SparseMatrix& b, const Op& op);
+
+    public:
+        /**
+         * @brief One entry of a matrix given as a list.
+         */
+        struct Entry {
+            int row; ///< The row of the entry.
+            int column; ///< The column of the entry.
+            int value; ///< The value of the entry.
+        };
+
+        /**
+         * @brief Default constructor initializes an empty matrix.
+         */
+        SparseMatrix() : size(0), rowStart(1, 0) {}
+
+        /**
+         * @brief Compresses the adjacency matrix of a graph.
+         * @param graph The graph to compress.
+         */
+        explicit SparseMatrix(const Graph& graph);
+
+        /**
+         * @brief Builds an n x n matrix from a list of entries, without a dense matrix.
+         *
+         * Entries may come in any order; entries at the same position are added up and
+         * zero results are not stored.
+         * @param n The number of rows and columns.
+         * @param entries The entries.
+         * @throws std::invalid_argument if n is negative or an entry is out of range.
+         */
+        SparseMatrix(int n, std::vector<Entry> entries);
+
+        /**
+         * @brief Gets the number of rows (and columns).
+         */
+        int getSize() const { return this->size; }
+
+        /**
+         * @brief Gets the number of stored (non-zero) entries.
+         */
+        long long nonZeros() const { return static_cast<long long>(this->columns.size()); }
+
+        /**
+         * @brief Gets the index of the first entry of row i.
+         */
+        long long rowBegin(int i) const { return this->rowStart[i]; }
+
+        /**
+         * @brief Gets one past the index of the last entry of row i.
+         */
+        long long rowEnd(int i) const { return this->rowStart[i + 1]; }
+
+        /**
+         * @brief Gets the column of entry e.
+         */
+        int column(long long e) const { return this->columns[e]; }
+
+        /**
+         * @brief Gets the value of entry e.
+         */
+        int value(long long e) const { return this->values[e]; }
+
+        /**
+         * @brief Expands the matrix back into a dense Graph.
+         */
+        Graph toGraph() const;
+
+        /**
+         * @brief Sparse x sparse product (SpGEMM) by Gustavson's row-by-row algorithm.
+         *
+         * Row i of the result is accumulated from the rows of other selected by row i of
+         * this matrix, in a dense per-thread accumulator; rows are split across threads.
+         * The work is proportional to the number of multiply-adds, not to n^3. Entries that
+         * cancel to zero are dropped. Arithmetic wraps modulo 2^32 like operator* on Graph.
+         * @param other The matrix to multiply by.
+         * @return The sparse product.
+         * @throws std::invalid_argument if the matrices are not of the same size.
+         */
+        SparseMatrix operator*(const SparseMatrix& other) const;
+
+        /**
+         * @brief Returns the transpose, built in O(n + nnz) by counting sort.
+         */
+        SparseMatrix transpose() const;
+
+        /**
+         * @brief Sparse matrix-vector product (SpMV, y = A x), parallel by row.
+         *
+         * Instantiated for int, long long and double; integer sums wrap (see Semiring::Wrapping).
+         * @param x The vector, of one entry per row.
+         * @return The product.
+         * @throws std::invalid_argument if the vector size does not match the matrix size.
+         */
+        template <typename T>
+        std::vector<T> operator*(const std::vector<T>& x) const;
+
+        /**
+         * @brief Sparse transposed product (y = A^T x).
+         * @param x The vector, of one entry per row.
+         * @return The product.
+         * @throws std::invalid_argument if the vector size does not match the matrix size.
+         */
+        template <typename T>
+        std::vector<T> transposedTimes(const std::vector<T>& x) const;
+
+        /**
+         * @brief Writes A x (or A^T x) into an existing vector, for iterative solvers.
+         *
+         * y is resized to the matrix size, which keeps its storage once it has that size.
+         * A^T x scatters each row into per-thread partial results; an iterative solver that
+         * needs it repeatedly should transpose() once and use A x instead.
+         * @param x The vector, of one entry per row.
+         * @param y Receives the product; must not be x.
+         * @param transposed Multiplies by A^T instead of A.
+         * @throws std::invalid_argument if the vector size does not match the matrix size or y is x.
+         */
+        template <typename T>
+        void multiplyVector(const std::vector<T>& x, std::vector<T>& y, bool transposed = false) const;
+
+        /**
+         * @brief Adds two matrices by merging their sorted rows; cancelled entries are dropped.
+         * @param other The matrix to add.
+         * @return The sum, in O(nnz) work.
+         * @throws std::invalid_argument if the matrices are not of the same size.
+         */
+        SparseMatrix operator+(const SparseMatrix& other) const;
+
+        /**
+         * @brief Subtracts a matrix by merging sorted rows; cancelled entries are dropped.
+         * @param other The matrix to subtract.
+         * @return The difference, in O(nnz) work.
+         * @throws std::invalid_argument if the matrices are not of the same size.
+         */
+        SparseMatrix operator-(const SparseMatrix& other) const;
+
+        /**
+         * @brief Compares two matrices with the same rules as Graph::operator>.
+         *
+         * Entry-wise containment decides first, then the number of entries equal to 1, then
+         * the row-major order of the values; everything is found in one merge over the
+         * stored entries.
+         * @param other The matrix to compare with.
+         * @return True if this matrix is greater than the other, false otherwise.
+         * @throws std::invalid_argument if the matrices are not of the same size.
+         */
+        bool operator>(const SparseMatrix& other) const;
+
+        /**
+         * @brief Compares two matrices to determine if this matrix is less than the other.
+         */
+        bool operator<(const SparseMatrix& other) const;
+
+        /**
+         * @brief Compares two matrices for equality.
+         */
+        bool operator==(const SparseMatrix& other) const;
+
+        /**
+         * @brief Compares two matrices for inequality.
+         */
+        bool operator!=(const SparseMatrix& other) const;
+};
+
+#endif // SPARSEMATRIX_HPP
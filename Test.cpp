@@ -1,7 +1,11 @@
 #include "doctest.h"
 #include "Graph.hpp"
 #include "Algorithms.hpp"
+#include "SparseMatrix.hpp"
+#include "ProductChain.hpp"
+#include "Parallel.hpp"
 #include <vector>
+#include <algorithm>
 
 using namespace std;
 using namespace Algorithms;
@@ -207,9 +211,785 @@ TEST_CASE("Test negativeCycle")
         {0, 0, 1, 0},
     };
     g.setMatrix(graph3);
-    CHECK(Algorithms::negativeCycle(g)=="2->3->0->1->2");
+    CHECK(Algorithms::negativeCycle(g)=="0->3->2->1->0");
 }
 
+TEST_CASE("Test negativeCycles")
+{
+    Graph g;
+    // negative cycle 2->3->2 cannot be reached from vertex 0
+    vector<vector<int>> graph = {
+        {0, 1, 0, 0},
+        {1, 0, 0, 0},
+        {0, 0, 0, 2},
+        {0, 0, -5, 0},
+    };
+    g.setMatrix(graph);
+    CHECK(Algorithms::negativeCycle(g) == "2->3->2");
+
+    // two vertex-disjoint negative cycles: 0->1->0 and 2->3->4->2
+    vector<vector<int>> graph2 = {
+        {0, -3, 0, 0, 0},
+        {1, 0, 4, 0, 0},
+        {0, 0, 0, 1, 0},
+        {0, 0, 0, 0, 1},
+        {0, 0, -4, 0, 0},
+    };
+    g.setMatrix(graph2);
+    vector<vector<int>> cycles = Algorithms::negativeCycles(g);
+    CHECK(cycles.size() == 2);
+    CHECK(cycles[0] == vector<int>{0, 1, 0});
+    CHECK(cycles[1] == vector<int>{2, 3, 4, 2});
+
+    vector<vector<int>> graph3 = {
+        {0, 1, 0},
+        {1, 0, 1},
+        {0, 1, 0},
+    };
+    g.setMatrix(graph3);
+    CHECK(Algorithms::negativeCycles(g).empty());
+}
+
+TEST_CASE("Test minimumSpanningForest")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 4, 1, 0, 0, 0},
+        {4, 0, 2, 5, 0, 0},
+        {1, 2, 0, 8, 0, 0},
+        {0, 5, 8, 0, 0, 0},
+        {0, 0, 0, 0, 0, -3},
+        {0, 0, 0, 0, -3, 0}};
+    g.setMatrix(graph);
+
+    SpanningForest prim = Algorithms::minimumSpanningForest(g, MSTMethod::Prim);
+    SpanningForest kruskal = Algorithms::minimumSpanningForest(g, MSTMethod::Kruskal);
+    SpanningForest boruvka = Algorithms::minimumSpanningForest(g, MSTMethod::Boruvka);
+    CHECK(prim.totalWeight == 5);
+    CHECK(prim.edges.size() == 4);
+    CHECK(kruskal.totalWeight == 5);
+    CHECK(kruskal.edges.size() == 4);
+    CHECK(kruskal.edges[0].weight == -3);
+    CHECK(boruvka.totalWeight == 5);
+    CHECK(boruvka.edges.size() == 4);
+}
+TEST_CASE("Test allPairsShortestPaths")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 4, 0, 0, 1},
+        {0, 0, 0, -2, 0},
+        {0, 0, 0, 0, 0},
+        {0, 0, 3, 0, 0},
+        {0, 2, 0, 0, 0}};
+    g.setMatrix(graph);
+
+    DistanceTable fw = Algorithms::allPairsShortestPaths(g, APSPMethod::FloydWarshall);
+    DistanceTable johnson = Algorithms::allPairsShortestPaths(g, APSPMethod::Johnson);
+    CHECK(fw.negativeCycle == false);
+    CHECK(fw.distance(0, 2) == 4);
+    CHECK(fw.path(0, 2) == vector<int>{0, 4, 1, 3, 2});
+    CHECK(fw.distance(2, 0) == DistanceTable::INF);
+    CHECK(fw.path(2, 0).empty());
+    CHECK(johnson.dist == fw.dist);
+    CHECK(johnson.path(0, 2) == vector<int>{0, 4, 1, 3, 2});
+
+    vector<vector<int>> graph2 = {
+        {0, 1, 0},
+        {0, 0, -3},
+        {1, 0, 0}};
+    g.setMatrix(graph2);
+    CHECK(Algorithms::allPairsShortestPaths(g, APSPMethod::FloydWarshall).negativeCycle == true);
+    CHECK(Algorithms::allPairsShortestPaths(g, APSPMethod::Johnson).negativeCycle == true);
+    graph2 = {{0, 1}, {0, -1}};
+    g.setMatrix(graph2);
+    CHECK(Algorithms::allPairsShortestPaths(g, APSPMethod::FloydWarshall).negativeCycle == true);
+
+    // a dense negative cycle wider than one tile is caught before the blocked relaxation
+    int n = 70;
+    vector<vector<int>> dense(n, vector<int>(n, -1000000));
+    for (int v = 0; v < n; ++v) dense[v][v] = 0;
+    g.setMatrix(dense);
+    DistanceTable cyclic = Algorithms::allPairsShortestPaths(g);
+    CHECK(cyclic.negativeCycle == true);
+    CHECK(cyclic.path(0, 1).empty());
+
+    // next hops that go round a cycle without reaching j give no path, not a truncated one
+    DistanceTable looping;
+    looping.n = 3;
+    looping.dist.assign(9, 0);
+    looping.next = {0, 1, 1, 0, 1, 0, 0, 1, 2};
+    CHECK(looping.path(0, 2).empty());
+    CHECK(looping.path(0, 1) == vector<int>{0, 1});
+}
+TEST_CASE("Test transitiveClosure")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 1, 0, 0},
+        {0, 0, 1, 0},
+        {0, 1, 0, 0},
+        {0, 0, 0, 0}};
+    g.setMatrix(graph);
+
+    BitMatrix reach = Algorithms::transitiveClosure(g);
+    CHECK(reach.get(0, 2) == true);
+    CHECK(reach.get(1, 1) == true);
+    CHECK(reach.get(0, 0) == false);
+    CHECK(reach.get(2, 0) == false);
+    CHECK(reach.countRow(3) == 0);
+    CHECK(reach.count() == 6);
+
+    BitMatrix adjacency(g);
+    BitMatrix twoSteps = adjacency * adjacency;
+    CHECK(twoSteps.get(0, 2) == true);
+    CHECK(twoSteps.get(1, 1) == true);
+    CHECK(twoSteps.get(0, 1) == false);
+    CHECK(twoSteps == BitMatrix(g.multiply<Semiring::OrAnd>(g)));
+}
+
+TEST_CASE("Test pageRank")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 1, 0},
+        {0, 0, 1},
+        {1, 0, 0}};
+    g.setMatrix(graph);
+
+    vector<double> rank = Algorithms::pageRank(g);
+    CHECK(rank[0] == doctest::Approx(1.0 / 3));
+    CHECK(rank[2] == doctest::Approx(1.0 / 3));
+
+    // ranks through the cycle 0->1->2->0 restarting at 0 with probability 1/2 are 4/7, 2/7, 1/7
+    vector<pair<int, double>> local = Algorithms::personalizedPageRank(g, 0, 0.5, 1e-9);
+    CHECK(local.size() == 3);
+    CHECK(local[0].first == 0);
+    CHECK(local[0].second == doctest::Approx(4.0 / 7));
+    CHECK(local[2].first == 2);
+    CHECK(local[2].second == doctest::Approx(1.0 / 7));
+
+    vector<vector<int>> graph2 = {
+        {0, 1, 1, 0},
+        {0, 0, 1, 0},
+        {1, 0, 0, 0},
+        {0, 0, 1, 0}};
+    g.setMatrix(graph2);
+    rank = Algorithms::pageRank(g);
+    CHECK(rank[0] + rank[1] + rank[2] + rank[3] == doctest::Approx(1.0));
+    CHECK(rank[2] > rank[0]);
+    CHECK(rank[3] == doctest::Approx(0.15 / 4));
+
+    vector<vector<int>> graph3 = {
+        {0, 1},
+        {0, 0}};
+    g.setMatrix(graph3);
+    rank = Algorithms::pageRank(g);
+    CHECK(rank[0] + rank[1] == doctest::Approx(1.0));
+    CHECK(rank[1] > rank[0]);
+    CHECK_THROWS_AS(Algorithms::personalizedPageRank(g, 2), std::invalid_argument);
+}
+
+TEST_CASE("Test betweenness")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 1, 0, 0},
+        {1, 0, 1, 0},
+        {0, 1, 0, 1},
+        {0, 0, 1, 0}};
+    g.setMatrix(graph);
+    CHECK(Algorithms::betweenness(g) == vector<double>{0, 4, 4, 0});
+
+    vector<vector<int>> graph2 = {
+        {0, 1, 1, 0},
+        {0, 0, 0, 1},
+        {0, 0, 0, 1},
+        {0, 0, 0, 0}};
+    g.setMatrix(graph2);
+    CHECK(Algorithms::betweenness(g) == vector<double>{0, 0.5, 0.5, 0});
+
+    vector<vector<int>> graph3 = {
+        {0, 1, 5},
+        {0, 0, 1},
+        {0, 0, 0}};
+    g.setMatrix(graph3);
+    CHECK(Algorithms::betweenness(g) == vector<double>{0, 0, 0});
+    CHECK(Algorithms::betweenness(g, BetweennessMethod::Weighted) == vector<double>{0, 1, 0});
+    CHECK(Algorithms::betweenness(g, BetweennessMethod::Weighted, 3) == vector<double>{0, 1, 0});
+
+    vector<vector<int>> graph4 = {
+        {0, 1, 0, 0, 0},
+        {1, 0, 1, 1, 1},
+        {0, 1, 0, 0, 0},
+        {0, 1, 0, 0, 0},
+        {0, 1, 0, 0, 0}};
+    g.setMatrix(graph4);
+    vector<double> sampled = Algorithms::betweenness(g, BetweennessMethod::Unweighted, 2, 7);
+    CHECK(sampled[0] == 0);
+    CHECK(sampled[2] == 0);
+    CHECK(Algorithms::betweenness(g)[1] == 12);
+
+    // a 9-vertex path on 4 workers, which fill only 3 chunks of sources
+    vector<vector<int>> path(9, vector<int>(9, 0));
+    for (int v = 0; v + 1 < 9; ++v) path[v][v + 1] = path[v + 1][v] = 1;
+    g.setMatrix(path);
+    Parallel::setThreadCount(4);
+    vector<double> scores = Algorithms::betweenness(g);
+    Parallel::setThreadCount(0);
+    CHECK(scores == vector<double>{0, 14, 24, 30, 32, 30, 24, 14, 0});
+
+    CHECK(Algorithms::betweennessSampleSize(1000, 0.5, 0.1) == 20);
+    CHECK(Algorithms::betweennessSampleSize(10, 0.01, 0.1) == 10);
+    CHECK_THROWS_AS(Algorithms::betweenness(g, BetweennessMethod::Unweighted, -1), std::invalid_argument);
+    CHECK_THROWS_AS(Algorithms::betweennessSampleSize(10, 0, 0.1), std::invalid_argument);
+
+    graph3[0][1] = -1;
+    g.setMatrix(graph3);
+    CHECK_THROWS_AS(Algorithms::betweenness(g, BetweennessMethod::Weighted), std::invalid_argument);
+}
+
+TEST_CASE("Test triangle counting")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 1, 1, 1, 0},
+        {1, 0, 1, 1, 0},
+        {1, 1, 0, 1, 0},
+        {1, 1, 1, 0, 1},
+        {0, 0, 0, 1, 0}};
+    g.setMatrix(graph);
+
+    CHECK(Algorithms::triangleCount(g) == 4);
+    TriangleCounts counts = Algorithms::triangles(g);
+    CHECK(counts.total == 4);
+    CHECK(counts.perVertex == vector<long long>{3, 3, 3, 3, 0});
+    CHECK(counts.edges.size() == 7);
+    CHECK(counts.edges[0] == pair<int, int>(0, 1));
+    CHECK(counts.edges[6] == pair<int, int>(3, 4));
+    CHECK(counts.perEdge == vector<long long>{2, 2, 2, 2, 2, 2, 0});
+    vector<double> coefficient = Algorithms::clusteringCoefficients(g);
+    CHECK(coefficient[0] == 1);
+    CHECK(coefficient[3] == doctest::Approx(0.5));
+    CHECK(coefficient[4] == 0);
+
+    // compare both kernels with trace(A^3) / 6 on a dense and a sparse random graph
+    for (int percent : {50, 4}) {
+        int n = 60;
+        vector<vector<int>> random(n, vector<int>(n, 0));
+        unsigned int state = 12345;
+        for (int u = 0; u < n; ++u) {
+            for (int v = u + 1; v < n; ++v) {
+                state = state * 1103515245u + 12345u;
+                if ((state >> 16) % 100 < static_cast<unsigned int>(percent)) random[u][v] = random[v][u] = 1;
+            }
+        }
+        g.setMatrix(random);
+        Graph cube = g * g * g;
+        long long trace = 0;
+        for (int v = 0; v < n; ++v) trace += cube.getMatrix()[v][v];
+        CHECK(Algorithms::triangleCount(g) == trace / 6);
+        CHECK(Algorithms::triangles(g).total == trace / 6);
+    }
+}
+
+TEST_CASE("Test coreNumbers")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 1, 1, 1, 0, 0},
+        {1, 0, 1, 1, 0, 0},
+        {1, 1, 0, 1, 0, 0},
+        {1, 1, 1, 0, 1, 0},
+        {0, 0, 0, 1, 0, 0},
+        {0, 0, 0, 0, 0, 0}};
+    g.setMatrix(graph);
+
+    for (CoreMethod method : {CoreMethod::Peeling, CoreMethod::LevelSynchronous}) {
+        CoreDecomposition cores = Algorithms::coreNumbers(g, method);
+        CHECK(cores.core == vector<int>{3, 3, 3, 3, 1, 0});
+        CHECK(cores.degeneracy == 3);
+        CHECK(cores.order.size() == 6);
+        // every vertex has at most degeneracy neighbours later in the ordering
+        vector<int> place(6);
+        for (int i = 0; i < 6; ++i) place[cores.order[i]] = i;
+        for (int u = 0; u < 6; ++u) {
+            int later = 0;
+            for (int v = 0; v < 6; ++v) {
+                if (graph[u][v] != 0 && place[v] > place[u]) ++later;
+            }
+            CHECK(later <= cores.degeneracy);
+        }
+    }
+
+    vector<vector<int>> graph2 = {
+        {0, 1, 0, 0},
+        {0, 0, 1, 0},
+        {1, 0, 0, 0},
+        {0, 0, 1, 0}};
+    g.setMatrix(graph2);
+    CHECK(Algorithms::coreNumbers(g).core == vector<int>{2, 2, 2, 1});
+    CHECK(Algorithms::coreNumbers(g, CoreMethod::LevelSynchronous).core == vector<int>{2, 2, 2, 1});
+}
+
+TEST_CASE("Test biconnectedComponents")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 1, 1, 0, 0, 0, 0},
+        {1, 0, 1, 0, 0, 0, 0},
+        {1, 1, 0, 1, 0, 0, 0},
+        {0, 0, 1, 0, 1, 1, 0},
+        {0, 0, 0, 1, 0, 1, 0},
+        {0, 0, 0, 1, 1, 0, 0},
+        {0, 0, 0, 0, 0, 0, 0}};
+    g.setMatrix(graph);
+
+    Biconnectivity parts = Algorithms::biconnectedComponents(g);
+    CHECK(parts.articulationPoints == vector<int>{2, 3});
+    CHECK(parts.bridges == vector<pair<int, int>>{{2, 3}});
+    CHECK(parts.components == vector<vector<int>>{{0, 1, 2}, {2, 3}, {3, 4, 5}});
+
+    // on a path every inner vertex is a cut vertex and every edge a bridge
+    int n = 3000;
+    vector<vector<int>> path(n, vector<int>(n, 0));
+    for (int v = 0; v + 1 < n; ++v) path[v][v + 1] = path[v + 1][v] = 1;
+    g.setMatrix(path);
+    parts = Algorithms::biconnectedComponents(g);
+    CHECK(parts.articulationPoints.size() == static_cast<size_t>(n - 2));
+    CHECK(parts.bridges.size() == static_cast<size_t>(n - 1));
+    CHECK(parts.components.size() == static_cast<size_t>(n - 1));
+}
+
+TEST_CASE("Test topologicalOrder and DAG paths")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 3, 2, 0, 0},
+        {0, 0, 0, 4, 0},
+        {0, -1, 0, 6, 0},
+        {0, 0, 0, 0, 1},
+        {0, 0, 0, 0, 0}};
+    g.setMatrix(graph);
+
+    TopologicalOrder topo = Algorithms::topologicalOrder(g);
+    CHECK(topo.acyclic == true);
+    CHECK(topo.order == vector<int>{0, 2, 1, 3, 4});
+    CHECK(topo.cycle.empty());
+
+    DagPaths shortest = Algorithms::dagPaths(g, 0);
+    CHECK(shortest.dist == vector<long long>{0, 1, 2, 5, 6});
+    CHECK(shortest.path(4) == vector<int>{0, 2, 1, 3, 4});
+    DagPaths longest = Algorithms::dagPaths(g, 0, PathObjective::Longest);
+    CHECK(longest.dist[4] == 9);
+    CHECK(longest.path(4) == vector<int>{0, 2, 3, 4});
+    DagPaths fromThree = Algorithms::dagPaths(g, 3);
+    CHECK(fromThree.dist[0] == DistanceTable::INF);
+    CHECK(fromThree.path(0).empty());
+
+    CriticalPath critical = Algorithms::criticalPath(g);
+    CHECK(critical.length == 9);
+    CHECK(critical.path == vector<int>{0, 2, 3, 4});
+
+    vector<vector<int>> graph2 = {
+        {0, 1, 0, 0},
+        {0, 0, 1, 0},
+        {0, 0, 0, 1},
+        {0, 1, 0, 0}};
+    g.setMatrix(graph2);
+    topo = Algorithms::topologicalOrder(g);
+    CHECK(topo.acyclic == false);
+    CHECK(topo.order.empty());
+    CHECK(topo.cycle == vector<int>{2, 3, 1, 2});
+    CHECK_THROWS_AS(Algorithms::dagPaths(g, 0), std::invalid_argument);
+    CHECK_THROWS_AS(Algorithms::criticalPath(g), std::invalid_argument);
+}
+
+TEST_CASE("Test maxFlow")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 16, 13, 0, 0, 0},
+        {0, 0, 10, 12, 0, 0},
+        {0, 4, 0, 0, 14, 0},
+        {0, 0, 9, 0, 0, 20},
+        {0, 0, 0, 7, 0, 4},
+        {0, 0, 0, 0, 0, 0}};
+    g.setMatrix(graph);
+
+    FlowResult flow = Algorithms::maxFlow(g, 0, 5, true);
+    CHECK(flow.value == 23);
+    CHECK(flow.sourceSide == vector<int>{0, 1, 2, 4});
+    int intoSink = 0;
+    for (int u = 0; u < 6; ++u) {
+        intoSink += flow.flow[u][5];
+        for (int v = 0; v < 6; ++v) CHECK(flow.flow[u][v] <= graph[u][v]);
+    }
+    CHECK(intoSink == 23);
+    for (int v = 1; v < 5; ++v) {
+        int balance = 0;
+        for (int u = 0; u < 6; ++u) balance += flow.flow[u][v] - flow.flow[v][u];
+        CHECK(balance == 0);
+    }
+    CHECK(Algorithms::maxFlow(g, 5, 0).value == 0);
+    CHECK(Algorithms::maxFlow(g, 5, 0).sourceSide == vector<int>{5});
+    CHECK(Algorithms::maxFlow(g, 0, 5).flow.empty());
+
+    CHECK_THROWS_AS(Algorithms::maxFlow(g, 0, 0), std::invalid_argument);
+    CHECK_THROWS_AS(Algorithms::maxFlow(g, 0, 6), std::invalid_argument);
+    graph[1][2] = -1;
+    g.setMatrix(graph);
+    CHECK_THROWS_AS(Algorithms::maxFlow(g, 0, 5), std::invalid_argument);
+}
+
+TEST_CASE("Test bipartite matching and assignment")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 0, 0, 1, 1, 0},
+        {0, 0, 0, 1, 0, 0},
+        {0, 0, 0, 0, 1, 1},
+        {1, 1, 0, 0, 0, 0},
+        {1, 0, 1, 0, 0, 0},
+        {0, 0, 1, 0, 0, 0}};
+    g.setMatrix(graph);
+
+    Matching matching = Algorithms::maxBipartiteMatching(g);
+    CHECK(matching.pairs == vector<pair<int, int>>{{0, 4}, {1, 3}, {2, 5}});
+    CHECK(matching.mate == vector<int>{4, 3, 5, 1, 0, 2});
+
+    vector<vector<int>> graph2 = {
+        {0, 1, 1, 1},
+        {1, 0, 0, 0},
+        {1, 0, 0, 0},
+        {1, 0, 0, 0}};
+    g.setMatrix(graph2);
+    CHECK(Algorithms::maxBipartiteMatching(g).pairs.size() == 1);
+
+    // a long path: later phases can only augment along ever longer shortest paths
+    int n = 200;
+    vector<vector<int>> line(n, vector<int>(n, 0));
+    for (int v = 0; v + 1 < n; ++v) line[v][v + 1] = line[v + 1][v] = 1;
+    g.setMatrix(line);
+    matching = Algorithms::maxBipartiteMatching(g);
+    CHECK(matching.pairs.size() == 100);
+    bool valid = true;
+    for (const pair<int, int>& edge : matching.pairs) {
+        valid = valid && line[edge.first][edge.second] == 1 && matching.mate[edge.second] == edge.first;
+    }
+    CHECK(valid);
+
+    vector<vector<int>> triangle = {
+        {0, 1, 1},
+        {1, 0, 1},
+        {1, 1, 0}};
+    g.setMatrix(triangle);
+    CHECK_THROWS_AS(Algorithms::maxBipartiteMatching(g), std::invalid_argument);
+
+    vector<vector<int>> costs = {
+        {4, 1, 3},
+        {2, 0, 5},
+        {3, 2, 2}};
+    g.setMatrix(costs);
+    Assignment assignment = Algorithms::minimumCostAssignment(g);
+    CHECK(assignment.cost == 5);
+    CHECK(assignment.column == vector<int>{1, 0, 2});
+    CHECK(Algorithms::minimumCostAssignment(-g).cost == -11);
+
+    // compare with every permutation
+    vector<vector<int>> random(6, vector<int>(6));
+    unsigned int state = 99;
+    for (vector<int>& row : random) {
+        for (int& cost : row) {
+            state = state * 1103515245u + 12345u;
+            cost = static_cast<int>((state >> 16) % 50) - 10;
+        }
+    }
+    g.setMatrix(random);
+    vector<int> order = {0, 1, 2, 3, 4, 5};
+    long long best = numeric_limits<long long>::max();
+    do {
+        long long cost = 0;
+        for (int i = 0; i < 6; ++i) cost += random[i][order[i]];
+        best = min(best, cost);
+    } while (next_permutation(order.begin(), order.end()));
+    CHECK(Algorithms::minimumCostAssignment(g).cost == best);
+}
+
+TEST_CASE("Test greedyColoring")
+{
+    Graph g;
+    // a crown graph: two colors suffice, but the natural order below needs 4
+    vector<vector<int>> graph = {
+        {0, 0, 0, 0, 0, 1, 1, 1},
+        {0, 0, 0, 0, 1, 0, 1, 1},
+        {0, 0, 0, 0, 1, 1, 0, 1},
+        {0, 0, 0, 0, 1, 1, 1, 0},
+        {0, 1, 1, 1, 0, 0, 0, 0},
+        {1, 0, 1, 1, 0, 0, 0, 0},
+        {1, 1, 0, 1, 0, 0, 0, 0},
+        {1, 1, 1, 0, 0, 0, 0, 0}};
+    vector<vector<int>> interleaved(8, vector<int>(8, 0));
+    // renumber so the natural order alternates between the two sides
+    vector<int> label = {0, 2, 4, 6, 1, 3, 5, 7};
+    for (int u = 0; u < 8; ++u) {
+        for (int v = 0; v < 8; ++v) interleaved[label[u]][label[v]] = graph[u][v];
+    }
+    g.setMatrix(interleaved);
+
+    CHECK(Algorithms::greedyColoring(g, ColoringMethod::Natural).colors == 4);
+    for (ColoringMethod method : {ColoringMethod::Natural, ColoringMethod::LargestFirst,
+                                  ColoringMethod::SmallestLast, ColoringMethod::Speculative}) {
+        Coloring coloring = Algorithms::greedyColoring(g, method);
+        for (int u = 0; u < 8; ++u) {
+            for (int v = 0; v < 8; ++v) {
+                if (interleaved[u][v] != 0) CHECK(coloring.color[u] != coloring.color[v]);
+            }
+        }
+        CHECK(coloring.colors <= 4);
+    }
+
+    vector<vector<int>> graph2 = {
+        {0, 1, 1, 1},
+        {1, 0, 1, 0},
+        {1, 1, 0, 0},
+        {1, 0, 0, 0}};
+    g.setMatrix(graph2);
+    Coloring coloring = Algorithms::greedyColoring(g);
+    CHECK(coloring.colors == 3);
+    CHECK(Algorithms::greedyColoring(g, ColoringMethod::Speculative).colors == 3);
+}
+
+TEST_CASE("Test globalMinCut")
+{
+    Graph g;
+    vector<vector<int>> graph(8, vector<int>(8, 0));
+    vector<Edge> edges = {{0, 1, 2}, {0, 4, 3}, {1, 2, 3}, {1, 4, 2}, {1, 5, 2}, {2, 3, 4},
+                          {2, 6, 2}, {3, 6, 2}, {3, 7, 2}, {4, 5, 3}, {5, 6, 1}, {6, 7, 3}};
+    for (const Edge& e : edges) graph[e.u][e.v] = graph[e.v][e.u] = e.weight;
+    g.setMatrix(graph);
+
+    GlobalCut cut = Algorithms::globalMinCut(g);
+    CHECK(cut.value == 4);
+    vector<int> small = cut.side.size() == 4 && cut.side[0] == 2 ? cut.side : cut.otherSide;
+    CHECK(small == vector<int>{2, 3, 6, 7});
+    GlobalCut random = Algorithms::globalMinCut(g, MinCutMethod::KargerStein);
+    CHECK(random.value == 4);
+    CHECK(!random.side.empty());
+    CHECK(random.side.size() + random.otherSide.size() == 8);
+
+    // K8 of weight 5 with more workers than trial chunks: every cut splits off one vertex
+    vector<vector<int>> complete(8, vector<int>(8, 5));
+    for (int v = 0; v < 8; ++v) complete[v][v] = 0;
+    g.setMatrix(complete);
+    Parallel::setThreadCount(4);
+    random = Algorithms::globalMinCut(g, MinCutMethod::KargerStein);
+    Parallel::setThreadCount(0);
+    CHECK(random.value == 35);
+    CHECK(!random.side.empty());
+    CHECK(random.side.size() + random.otherSide.size() == 8);
+
+    // two cliques joined by a single light edge
+    int n = 80;
+    vector<vector<int>> graph2(n, vector<int>(n, 0));
+    for (int u = 0; u < n; ++u) {
+        for (int v = 0; v < n; ++v) {
+            if (u != v && (u < 40) == (v < 40)) graph2[u][v] = 5;
+        }
+    }
+    graph2[3][54] = graph2[54][3] = 2;
+    g.setMatrix(graph2);
+    for (MinCutMethod method : {MinCutMethod::StoerWagner, MinCutMethod::KargerStein}) {
+        cut = Algorithms::globalMinCut(g, method);
+        CHECK(cut.value == 2);
+        CHECK(cut.side.size() == 40);
+    }
+
+    vector<vector<int>> graph3 = {{0}};
+    g.setMatrix(graph3);
+    CHECK_THROWS_AS(Algorithms::globalMinCut(g), std::invalid_argument);
+}
+
+TEST_CASE("Test cliques")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 1, 1, 1, 0, 0},
+        {1, 0, 1, 1, 0, 0},
+        {1, 1, 0, 1, 1, 0},
+        {1, 1, 1, 0, 0, 0},
+        {0, 0, 1, 0, 0, 1},
+        {0, 0, 0, 0, 1, 0}};
+    g.setMatrix(graph);
+
+    CHECK(Algorithms::maximalCliques(g) == vector<vector<int>>{{0, 1, 2, 3}, {2, 4}, {4, 5}});
+    CHECK(Algorithms::maximalCliques(g, 3) == vector<vector<int>>{{0, 1, 2, 3}});
+    CHECK(Algorithms::maximumClique(g) == vector<int>{0, 1, 2, 3});
+
+    // a 5-clique hidden among 100 vertices with no triangles elsewhere
+    int n = 100;
+    vector<vector<int>> graph2(n, vector<int>(n, 0));
+    for (int v = 0; v + 1 < n; ++v) graph2[v][v + 1] = graph2[v + 1][v] = 1;
+    vector<int> hidden = {7, 23, 51, 70, 98};
+    for (int a : hidden) {
+        for (int b : hidden) {
+            if (a != b) graph2[a][b] = 1;
+        }
+    }
+    g.setMatrix(graph2);
+    CHECK(Algorithms::maximumClique(g) == hidden);
+    CHECK(Algorithms::maximalCliques(g, 4) == vector<vector<int>>{hidden});
+    g.setMatrix(vector<vector<int>>{{0}});
+    CHECK(Algorithms::maximumClique(g) == vector<int>{0});
+}
+
+TEST_CASE("Test diameter and eccentricities")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 1, 0, 10, 0, 0},
+        {0, 0, 1, 0, 0, 0},
+        {0, 0, 0, 5, 0, 0},
+        {0, 0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0, 2},
+        {0, 0, 0, 0, 0, 0}};
+    g.setMatrix(graph);
+
+    CHECK(Algorithms::diameter(g) == 2);
+    CHECK(Algorithms::eccentricities(g) == vector<long long>{2, 2, 2, 2, 1, 1});
+    CHECK(Algorithms::diameter(g, Algorithms::DistanceMetric::Weights) == 7);
+    CHECK(Algorithms::eccentricities(g, Algorithms::DistanceMetric::Weights) == vector<long long>{7, 6, 5, 7, 2, 2});
+
+    // a cycle of 101 vertices has every eccentricity 50
+    int n = 101;
+    vector<vector<int>> graph2(n, vector<int>(n, 0));
+    for (int v = 0; v < n; ++v) graph2[v][(v + 1) % n] = 1;
+    g.setMatrix(graph2);
+    CHECK(Algorithms::diameter(g) == 50);
+    CHECK(Algorithms::eccentricities(g) == vector<long long>(n, 50));
+
+    graph2[0][1] = -1;
+    g.setMatrix(graph2);
+    CHECK(Algorithms::diameter(g) == 50);
+    CHECK_THROWS(Algorithms::diameter(g, Algorithms::DistanceMetric::Weights));
+    g.setMatrix(vector<vector<int>>{{0}});
+    CHECK(Algorithms::diameter(g) == 0);
+}
+
+TEST_CASE("Test closeness and hop distances")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 5, 0, 0},
+        {1, 0, 7, 0},
+        {0, 1, 0, 0},
+        {0, 0, 0, 0}};
+    g.setMatrix(graph);
+
+    Algorithms::Closeness scores = Algorithms::closeness(g);
+    CHECK(scores.harmonic == vector<double>{1.5, 2, 1.5, 0});
+    CHECK(scores.closeness[1] == doctest::Approx(2.0 / 3));
+    CHECK(scores.closeness[0] == doctest::Approx(2.0 / 3 * 2.0 / 3));
+    CHECK(scores.closeness[3] == 0);
+
+    Algorithms::DistanceTable table = Algorithms::hopDistances(g);
+    CHECK(table.distance(0, 2) == 2);
+    CHECK(table.distance(2, 0) == 2);
+    CHECK(table.distance(0, 3) == Algorithms::DistanceTable::INF);
+    CHECK(table.path(0, 2) == vector<int>{0, 1, 2});
+
+    // more sources than one 256-wide batch: a directed cycle of 300 vertices
+    int n = 300;
+    vector<vector<int>> graph2(n, vector<int>(n, 0));
+    for (int v = 0; v < n; ++v) graph2[v][(v + 1) % n] = 1;
+    g.setMatrix(graph2);
+    table = Algorithms::hopDistances(g);
+    CHECK(table.distance(299, 298) == 299);
+    CHECK(table.distance(10, 5) == 295);
+    CHECK(table.path(298, 1) == vector<int>{298, 299, 0, 1});
+    scores = Algorithms::closeness(g);
+    CHECK(scores.closeness[0] == doctest::Approx(scores.closeness[299]));
+
+    // next hops picked during the BFS: every path walks real edges and has the BFS length
+    n = 40;
+    vector<vector<int>> graph3(n, vector<int>(n, 0));
+    for (int v = 0; v < n; ++v) {
+        graph3[v][(v * 7 + 3) % n] = 1;
+        graph3[v][(v * 11 + 5) % n] = 1;
+    }
+    for (int v = 0; v < n; ++v) graph3[v][v] = 0;
+    g.setMatrix(graph3);
+    table = Algorithms::hopDistances(g);
+    bool consistent = true;
+    for (int u = 0; u < n; ++u) {
+        for (int v = 0; v < n; ++v) {
+            vector<int> path = table.path(u, v);
+            if (table.distance(u, v) == Algorithms::DistanceTable::INF) {
+                consistent = consistent && path.empty();
+                continue;
+            }
+            consistent = consistent && static_cast<long long>(path.size()) == table.distance(u, v) + 1;
+            for (size_t k = 0; consistent && k + 1 < path.size(); ++k) {
+                consistent = graph3[path[k]][path[k + 1]] != 0;
+            }
+        }
+    }
+    CHECK(consistent);
+}
+
+TEST_CASE("Test k shortest paths")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 1, 4, 0, 0},
+        {0, 0, 1, 3, 0},
+        {0, 0, 0, 1, 5},
+        {0, 0, 0, 0, 1},
+        {0, 0, 0, 0, 0}};
+    g.setMatrix(graph);
+
+    vector<Algorithms::RankedPath> paths = Algorithms::kShortestPaths(g, 0, 4, 3);
+    REQUIRE(paths.size() == 3);
+    CHECK(paths[0].cost == 4);
+    CHECK(paths[0].vertices == vector<int>{0, 1, 2, 3, 4});
+    CHECK(paths[1].cost == 5);
+    CHECK(paths[1].vertices == vector<int>{0, 1, 3, 4});
+    CHECK(paths[2].cost == 6);
+    CHECK(paths[2].vertices == vector<int>{0, 2, 3, 4});
+
+    paths = Algorithms::kShortestPaths(SparseMatrix(g), 0, 4, 10);
+    REQUIRE(paths.size() == 5);
+    CHECK(paths[3].vertices == vector<int>{0, 1, 2, 4});
+    CHECK(paths[4].cost == 9);
+    CHECK(paths[4].vertices == vector<int>{0, 2, 4});
+
+    paths = Algorithms::kShortestPaths(g, 2, 2, 5);
+    REQUIRE(paths.size() == 1);
+    CHECK(paths[0].cost == 0);
+    CHECK(paths[0].vertices == vector<int>{2});
+    CHECK(Algorithms::kShortestPaths(g, 4, 0, 5).empty());
+    CHECK(Algorithms::kShortestPaths(g, 0, 4, 0).empty());
+    CHECK_THROWS(Algorithms::kShortestPaths(g, 0, 5, 1));
+    CHECK_THROWS(Algorithms::kShortestPaths(g, 0, 4, -1));
+
+    graph[3][4] = -1;
+    g.setMatrix(graph);
+    CHECK_THROWS(Algorithms::kShortestPaths(g, 0, 4, 1));
+}
+
+TEST_CASE("Test parallel worker count")
+{
+    // 9 items on 4 workers fill only 3 chunks of 3
+    Parallel::setThreadCount(4);
+    vector<int> ran(4, 0);
+    int used = Parallel::forWorkers(0, 9, 1, [&](int worker, int lo, int hi) { ran[worker] = hi - lo; });
+    CHECK(used == 3);
+    CHECK(ran == vector<int>{3, 3, 3, 0});
+    used = Parallel::forWorkers(0, 4, 1, [&](int worker, int lo, int hi) { ran[worker] = hi - lo; });
+    CHECK(used == 4);
+    CHECK(Parallel::forWorkers(0, 0, 1, [&](int, int, int) {}) == 0);
+    Parallel::setThreadCount(0);
+}
 
 TEST_CASE("Test graph addition")
 {
@@ -267,6 +1047,264 @@ TEST_CASE("Test graph multiplication")
     CHECK((g3 == expected) == true);
 }
 
+TEST_CASE("Test semiring multiplication")
+{
+    const int INF = Semiring::MinPlus::zero;
+    Graph g1;
+    vector<vector<int>> graph1 = {
+        {0, 0, INF},
+        {INF, 0, 2},
+        {1, INF, 0}};
+    g1.setMatrix(graph1);
+
+    // zero-weight edge 0->1 is kept, missing edges stay INF
+    vector<vector<int>> expectedMinPlus = {
+        {0, 0, 2},
+        {3, 0, 2},
+        {1, 1, 0}};
+    CHECK(g1.multiply<Semiring::MinPlus>(g1).getMatrix() == expectedMinPlus);
+
+    Graph g2;
+    vector<vector<int>> graph2 = {
+        {0, 1, 0},
+        {0, 0, 1},
+        {0, 0, 0}};
+    g2.setMatrix(graph2);
+    vector<vector<int>> expectedOrAnd = {
+        {0, 0, 1},
+        {0, 0, 0},
+        {0, 0, 0}};
+    CHECK(g2.multiply<Semiring::OrAnd>(g2).getMatrix() == expectedOrAnd);
+    CHECK(g2.multiply<Semiring::PlusTimes>(g2).getMatrix() == (g2 * g2).getMatrix());
+
+    const int NONE = Semiring::MaxMin::zero;
+    Graph g3;
+    vector<vector<int>> graph3 = {
+        {NONE, 5, 2},
+        {NONE, NONE, 7},
+        {NONE, NONE, NONE}};
+    g3.setMatrix(graph3);
+    CHECK(g3.multiply<Semiring::MaxMin>(g3).getMatrix()[0][2] == 5);
+
+    // large finite weights saturate instead of overflowing
+    CHECK(Semiring::MinPlus::multiply(INF - 1, 5) == INF);
+    CHECK(Semiring::MinPlus::multiply(std::numeric_limits<int>::min(), -5) == std::numeric_limits<int>::min());
+    CHECK(Semiring::MinPlus::multiply(-7, 5) == -2);
+}
+
+TEST_CASE("Test graph power")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 1, 1},
+        {1, 0, 1},
+        {1, 1, 0}};
+    g.setMatrix(graph);
+
+    CHECK((g ^ 3) == g * g * g);
+    CHECK((g ^ 1) == g);
+    vector<vector<int>> identity = {
+        {1, 0, 0},
+        {0, 1, 0},
+        {0, 0, 1}};
+    CHECK((g ^ 0).getMatrix() == identity);
+    CHECK_THROWS_AS(g ^ -1, std::invalid_argument);
+
+    // walks of length k in the triangle: (2^k + 2(-1)^k) / 3 closed walks per vertex
+    CHECK(pow(g, 40)[0][0] == ((1LL << 40) + 2) / 3);
+    CHECK_THROWS_AS(g ^ 40, std::overflow_error);
+    CHECK(pow(g, 200, Accumulation::Saturating)[0][1] == std::numeric_limits<long long>::max());
+
+    const unsigned long long p = 1000000007ULL;
+    unsigned long long expected = 1;
+    for (int i = 0; i < 1000; ++i) expected = expected * 2 % p;
+    expected = (expected + 2) % p * ((p + 1) / 3) % p; // (2^1000 + 2) / 3 mod p
+    CHECK(pow(g, 1000, Accumulation::Modular, p)[1][1] == static_cast<long long>(expected));
+    CHECK_THROWS_AS(pow(g, 2, Accumulation::Modular, 1000), std::invalid_argument);
+}
+
+TEST_CASE("Test Strassen multiplication")
+{
+    const int n = 45;
+    vector<vector<int>> a(n, vector<int>(n)), b(n, vector<int>(n));
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            a[i][j] = (i * 7 + j * 3) % 11 - 5;
+            b[i][j] = (i * 5 + j * 13) % 9 - 4;
+        }
+    }
+    Graph g1, g2;
+    g1.setMatrix(a);
+    g2.setMatrix(b);
+    Graph classical = g1.multiply<Semiring::PlusTimes>(g2);
+
+    int saved = Graph::getStrassenCrossover();
+    Graph::setStrassenCrossover(8);
+    Graph strassen = g1 * g2;
+    Graph::setStrassenCrossover(saved);
+
+    CHECK(strassen.getMatrix() == classical.getMatrix());
+    CHECK_THROWS_AS(Graph::setStrassenCrossover(0), std::invalid_argument);
+
+    // 2 * 65536^2 = 2^33 wraps to 0 in the classical kernel as well
+    Graph big;
+    big.setMatrix(vector<vector<int>>(2, vector<int>(2, 65536)));
+    CHECK((big * big).getMatrix() == vector<vector<int>>(2, vector<int>(2, 0)));
+}
+
+TEST_CASE("Test sparse multiplication")
+{
+    // a long directed cycle with a few chords: far too sparse for the dense kernel
+    const int n = 64;
+    vector<vector<int>> a(n, vector<int>(n, 0));
+    for (int i = 0; i < n; ++i) a[i][(i + 1) % n] = 1;
+    a[0][32] = 2;
+    a[10][5] = -1;
+    Graph g;
+    g.setMatrix(a);
+
+    Graph squared = g * g;
+    CHECK(squared.getMatrix() == g.multiply<Semiring::PlusTimes>(g).getMatrix());
+    CHECK(squared.getMatrix()[0][2] == 1);
+    CHECK(squared.getMatrix()[0][33] == 2);
+
+    SparseMatrix sparse(g);
+    SparseMatrix sparseSquared = sparse * sparse;
+    CHECK(sparse.nonZeros() == 66);
+    CHECK(sparseSquared == SparseMatrix(squared));
+    CHECK(sparseSquared.toGraph() == squared);
+
+    // 1 * 1 + (-1) * 1 cancels out and is not stored
+    vector<vector<int>> b = {
+        {0, 1, 1},
+        {0, 0, 1},
+        {0, 0, -1}};
+    Graph h;
+    h.setMatrix(b);
+    SparseMatrix hs(h);
+    CHECK((hs * hs).nonZeros() == 2);
+}
+
+TEST_CASE("Test product chain")
+{
+    const int n = 40;
+    vector<vector<int>> dense(n, vector<int>(n)), filter(n, vector<int>(n, 0));
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) dense[i][j] = (i + 2 * j) % 3;
+    }
+    filter[3][0] = 1;
+    Graph a, b, f;
+    a.setMatrix(dense);
+    b.setMatrix(dense);
+    f.setMatrix(filter);
+
+    // the single-entry filter should be applied first
+    ProductChain chain = ProductChain(a) * b * f;
+    CHECK(chain.length() == 3);
+    CHECK(chain.plan() == "(0 * (1 * 2))");
+    Graph planned = chain;
+    CHECK(planned == (a * b) * f);
+
+    Graph single = ProductChain(a);
+    CHECK(single == a);
+
+    // longer chains multiply intermediates on both sides through reused scratch matrices
+    Graph longer = ProductChain(a) * f * b * a * f * b;
+    CHECK(longer == a * f * b * a * f * b);
+    Graph reused;
+    reused.assignProduct(a, b);
+    CHECK(reused == a * b);
+    reused.assignProduct(reused, f);
+    CHECK(reused == a * b * f);
+
+    Graph small;
+    small.setMatrix({{0, 1}, {1, 0}});
+    CHECK_THROWS_AS(ProductChain(a) * small, std::invalid_argument);
+}
+
+TEST_CASE("Test sparse addition and subtraction")
+{
+    SparseMatrix base(4, {{0, 1, 1}, {1, 2, 1}, {2, 3, 1}, {3, 0, 1}});
+    SparseMatrix delta(4, {{0, 1, -1}, {0, 2, 5}, {2, 3, 1}, {0, 2, -2}});
+    CHECK(delta.nonZeros() == 3);
+
+    SparseMatrix sum = base + delta;
+    CHECK(sum.nonZeros() == 4); // 0->1 cancels, 0->2 is new
+    CHECK(sum == SparseMatrix(base.toGraph() + delta.toGraph()));
+    SparseMatrix difference = base - delta;
+    CHECK(difference == SparseMatrix(base.toGraph() - delta.toGraph()));
+    CHECK((base - base).nonZeros() == 0);
+    CHECK_THROWS_AS(SparseMatrix(4, {{4, 0, 1}}), std::invalid_argument);
+    CHECK_THROWS_AS(base + SparseMatrix(3, {}), std::invalid_argument);
+
+    // comparisons agree with the dense Graph operators
+    SparseMatrix bigger = base + SparseMatrix(4, {{1, 3, 2}});
+    CHECK((bigger > base) == (bigger.toGraph() > base.toGraph()));
+    CHECK((base > bigger) == (base.toGraph() > bigger.toGraph()));
+    CHECK((sum > difference) == (sum.toGraph() > difference.toGraph()));
+    CHECK((difference > sum) == (difference.toGraph() > sum.toGraph()));
+    CHECK((base < bigger) == (base.toGraph() < bigger.toGraph()));
+}
+
+TEST_CASE("Test matrix-vector multiplication")
+{
+    Graph g;
+    vector<vector<int>> graph = {
+        {0, 2, 0, 1, 0},
+        {1, 0, 3, 0, 0},
+        {0, 0, 0, 0, -1},
+        {4, 0, 0, 0, 1},
+        {0, 0, 5, 0, 0}};
+    g.setMatrix(graph);
+    vector<int> x = {1, 2, 3, 4, 5};
+
+    CHECK(g * x == vector<int>{8, 10, -5, 9, 15});
+    CHECK(g.transposedTimes(x) == vector<int>{18, 2, 31, 1, 1});
+    vector<double> half = g * vector<double>{0.5, 0.5, 0.5, 0.5, 0.5};
+    CHECK(half[3] == doctest::Approx(2.5));
+
+    SparseMatrix sparse(g);
+    CHECK(sparse * x == g * x);
+    CHECK(sparse.transposedTimes(x) == g.transposedTimes(x));
+    vector<vector<int>> transposed(5, vector<int>(5));
+    for (int i = 0; i < 5; ++i) {
+        for (int j = 0; j < 5; ++j) transposed[j][i] = graph[i][j];
+    }
+    Graph gT;
+    gT.setMatrix(transposed);
+    CHECK(sparse.transpose() == SparseMatrix(gT));
+    CHECK(sparse.transpose().toGraph() == gT);
+    CHECK(sparse.transpose() * x == g.transposedTimes(x));
+
+    // the output buffer is reused between calls
+    vector<long long> y;
+    vector<long long> ones(5, 1);
+    g.multiplyVector(ones, y);
+    const long long* storage = y.data();
+    g.multiplyVector(ones, y, true);
+    CHECK(y.data() == storage);
+    CHECK(y == vector<long long>{5, 2, 8, 1, 0});
+    vector<int> tooShort = {1, 2};
+    CHECK_THROWS_AS(g * tooShort, std::invalid_argument);
+    CHECK_THROWS_AS(g.multiplyVector(y, y), std::invalid_argument);
+
+    // int products wrap modulo 2^32: 2 * 10^10 and 5 * 10^10
+    g.setMatrix(vector<vector<int>>(2, vector<int>(2, 100000)));
+    vector<int> large(2, 100000);
+    vector<int> wrapped(2, -1474836480);
+    CHECK(g * large == wrapped);
+    CHECK(g.transposedTimes(large) == wrapped);
+    CHECK(SparseMatrix(g) * large == wrapped);
+    CHECK(SparseMatrix(g).transposedTimes(large) == wrapped);
+    g.setMatrix(vector<vector<int>>(5, vector<int>(5, 100000)));
+    large.assign(5, 100000);
+    wrapped.assign(5, -1539607552);
+    CHECK(g * large == wrapped);
+    CHECK(g.transposedTimes(large) == wrapped);
+    CHECK(SparseMatrix(g) * large == wrapped);
+    CHECK(SparseMatrix(g).transposedTimes(large) == wrapped);
+}
+
 TEST_CASE("Test unary plus operator")
 {
     Graph g1;